@@ -11,6 +11,11 @@ int main(int argc, char **argv)
        char errorMessage[MAX_STR_LEN];
        CmdLineData cmdLineData;
        bool configUploadSuccess;
+
+       // fully buffer monitor output so large runs are not held up by 
+       // writing each line to the terminal or pipe
+          // function: setvbuf
+       setvbuf(stdout, NULL, _IOFBF, MONITOR_BUFFER_SIZE);
        
        // show title
           // function: printf
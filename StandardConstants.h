@@ -60,7 +60,22 @@
 
 #define MEM_SHIFT 1
 
-#define MEM_MAX 102400
+#define MEM_MIN 1024
+
+// memory sizes are in KB, this allows 16 TB of simulated memory
+#define MEM_MAX 17179869184LL
+
+// base returned when no free memory can hold an allocation
+#define MEM_NOT_PLACED -1
+
+// the smallest buddy block is sized so memory holds at most this many,
+// which bounds the free bitmaps for any memory size
+#define BUDDY_MAX_BLOCKS 1048576LL
+
+// enough bitmap levels for the most smallest blocks at 64 per word
+#define BUDDY_BITMAP_LEVELS 4
+
+#define BUDDY_WORD_BITS 64
 
 #define WRITE "w"
 
@@ -70,5 +85,11 @@
 
 #define EMPTY_QUEUE_VALUE -1
 
+#define LOG_CHUNK_SIZE 65536
+
+#define LOG_QUEUE_CHUNKS 8
+
+#define MONITOR_BUFFER_SIZE 1048576
+
 #endif  // STANDARD_CONSTANTS
                                 
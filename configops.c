@@ -40,15 +40,45 @@ Dependencies: copyString
 */
 void configCodeToString(int code, char *outString)
    {
-    // define array with eight items, and short (10) lengths
-    char displayStrings[8][10] = {"SJF-N", "SRTF-P", "FCFS_P", "RR-P", "FCFS-N",
-                                                     "Monitor", "File", "Both"};
+    // define array with fifteen items, and short (16) lengths
+    char displayStrings[33][16] = {"SJF-N", "SRTF-P", "FCFS_P", "RR-P",
+                                           "FCFS-N", "Monitor", "File", "Both",
+                                        "Non-Preemptive", "Preemptive", "Wall",
+                                          "Virtual", "Spin", "Sleep", "Hybrid",
+                                     "Single", "Batch", "None", "FCFS", "SSTF",
+                                     "SCAN", "C-LOOK", "Trace", "Chrome", "OS",
+                                            "Process", "Op", "Memory", "Exact",
+                                                  "First", "Best", "Next",
+                                                                      "Buddy"};
 
     // copy string to return parameter
        // function: copyString
     copyString(outString, displayStrings[code]);
    }
 
+/*
+Name: deviceCodeToString
+Process: utility function converts device code numbers
+         to the device names used by dev operations
+Function Input/Parameters: device code (int)
+Function Output/Parameters: resulting device name (char *)
+Function Output/Returned: none
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: copyString
+*/
+void deviceCodeToString(int code, char *outString)
+   {
+    // Define array with nine items, and short (16) lengths
+    char deviceStrings[DEVICE_COUNT][16] = {"ethernet", "hard drive",
+                                    "keyboard", "monitor", "printer", "serial",
+                                       "sound signal", "usb", "video signal"};
+
+    // copy string to return parameter
+       // function: copyString
+    copyString(outString, deviceStrings[code]);
+   }
+
 /*
 Name: displayConfigData
 Process: scree dump/display of all config data
@@ -63,6 +93,8 @@ void displayConfigData(ConfigDataType *configData)
    {
     // initialize function/variables
     char displayString[STD_STR_LEN];
+    int deviceCode, eventClass;
+    bool unitsShown = false, eventsShown = false;
 
     // print lines of display for all member values
        // function: printf, codeToString (translates coded items)
@@ -82,12 +114,90 @@ void displayConfigData(ConfigDataType *configData)
       {
        printf("Off\n");
       }
-    printf("Memory Available       : %d\n", configData->memAvailable);
+    printf("Memory Available       : %lld\n", configData->memAvailable);
+    configCodeToString(configData->memPlacementCode, displayString);
+    printf("Memory placement       : %s\n", displayString);
     printf("Process cycle rate:    : %d\n", configData->procCycleRate);
     printf("I/O cycle rate         : %d\n", configData->ioCycleRate);
     configCodeToString(configData->logToCode, displayString);
     printf("Log to selection       : %s\n", displayString);
-    printf("Log file name          : %s\n\n", configData->logToFileName);
+    printf("Log file name          : %s\n", configData->logToFileName);
+    configCodeToString(configData->clockCode, displayString);
+    printf("Clock mode             : %s\n", displayString);
+    configCodeToString(configData->timerWaitCode, displayString);
+    printf("Timer wait             : %s\n", displayString);
+    printf("Timer spin slice (usec): %d\n", configData->spinSliceUSec);
+    printf("Time scale             : %d\n", configData->timeScale);
+    printf("CPU batching           : ");
+    if(configData->cpuBatching)
+      {
+       printf("On\n");
+      }
+    else
+      {
+       printf("Off\n");
+      }
+    printf("I/O workers            : %d\n", configData->ioWorkers);
+    configCodeToString(configData->interruptDrainCode, displayString);
+    printf("Interrupt drain        : %s\n", displayString);
+    printf("Device units           : ");
+    for (deviceCode = 0; deviceCode < DEVICE_COUNT; deviceCode++)
+      {
+       if (configData->deviceUnits[deviceCode] > 0)
+         {
+          deviceCodeToString(deviceCode, displayString);
+          printf("%s%s %d", unitsShown ? ", " : "", displayString,
+                                          configData->deviceUnits[deviceCode]);
+          unitsShown = true;
+         }
+      }
+    if(!unitsShown)
+      {
+       printf("Unlimited");
+      }
+    printf("\n");
+    configCodeToString(configData->diskSchedCode, displayString);
+    printf("Disk scheduling        : %s\n", displayString);
+    printf("Disk cylinders         : %d\n", configData->diskCylinders);
+    printf("Disk seek (usec/cyl)   : %d\n", configData->diskSeekUSec);
+    configCodeToString(configData->logLevelCode, displayString);
+    printf("Log level              : %s\n", displayString);
+    printf("Log processes          : ");
+    if (configData->logFirstPid == 0 
+                             && configData->logLastPid == LOG_ALL_PROCESSES)
+      {
+       printf("All\n");
+      }
+    else if (configData->logLastPid == LOG_ALL_PROCESSES)
+      {
+       printf("%d and up\n", configData->logFirstPid);
+      }
+    else
+      {
+       printf("%d-%d\n", configData->logFirstPid, configData->logLastPid);
+      }
+    printf("Log events             : ");
+    if (configData->logEventMask == LOG_EVENT_ALL)
+      {
+       printf("All");
+      }
+    else
+      {
+       // list the selected classes in the config file order
+       for (eventClass = LOG_EVENT_STATE; eventClass < LOG_EVENT_ALL; 
+                                                               eventClass *= 2)
+         {
+          if (configData->logEventMask & eventClass)
+            {
+             printf("%s%s", eventsShown ? "," : "", 
+                   eventClass == LOG_EVENT_STATE ? "state" 
+                      : eventClass == LOG_EVENT_CPU ? "cpu"
+                         : eventClass == LOG_EVENT_IO ? "io" : "mem");
+             eventsShown = true;
+            }
+         }
+      }
+    printf("\n\n");
 
     // void function, no return
    }
@@ -117,11 +227,16 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
        // create pointer for data input
        ConfigDataType *tempData;
 
+       // set end line leader, captured up to the (missing) colon
+       const char END_LINE_LEADER[] = "End Simulator Configuration File.";
+
        // declare other variables
        FILE *fileAccessPtr;
        char dataBuffer[MAX_STR_LEN], lowerCaseDataBuffer[MAX_STR_LEN];
-       int intData, dataLineCode, lineCtr = 0;
+       long long intData;
+       int dataLineCode, lineCtr = 0;
        double doubleData;
+       bool endLineFound = false;
 
     // set endStateMsg to success
        // function: copyString
@@ -166,8 +281,37 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
        // function: malloc
     tempData = (ConfigDataType *)malloc(sizeof(ConfigDataType));
 
-    // loop to end of config data items
-    while (lineCtr < NUM_DATA_LINES)
+    // set defaults for optional config items
+    tempData->clockCode = CLOCK_WALL_CODE;
+    tempData->timerWaitCode = TIMER_SPIN_CODE;
+    tempData->spinSliceUSec = 0;
+    tempData->timeScale = 1;
+    tempData->cpuBatching = false;
+    tempData->ioWorkers = 0;
+    tempData->interruptDrainCode = INTERRUPT_SINGLE_CODE;
+
+    tempData->diskSchedCode = DISK_NONE_CODE;
+    tempData->diskCylinders = 200;
+    tempData->diskSeekUSec = 100;
+
+    // everything is logged by default
+    tempData->logLevelCode = LOG_LEVEL_MEMORY_CODE;
+    tempData->logFirstPid = 0;
+    tempData->logLastPid = LOG_ALL_PROCESSES;
+    tempData->logEventMask = LOG_EVENT_ALL;
+
+    // allocate requests name their base by default
+    tempData->memPlacementCode = MEM_PLACE_EXACT_CODE;
+
+    // devices default to unlimited units, every operation runs at once
+    for (intData = 0; intData < DEVICE_COUNT; intData++)
+      {
+       tempData->deviceUnits[intData] = 0;
+      }
+
+    // loop to end of config data items, required items first
+    // then any optional items up to the end line
+    while (!endLineFound)
       {
        // get line leader, check for failiure
           // function getStringToDelimiter
@@ -189,17 +333,22 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
           // return incomplete file error
           return false;
          }
+
        // strip trailing spaces of config leader lines
        // for use in other functions
           // function: stripTrailingSpaces
        stripTrailingSpaces(dataBuffer);
 
+       // check for end line found after all required items
+       endLineFound = lineCtr >= NUM_DATA_LINES 
+                     && compareString(dataBuffer, END_LINE_LEADER) == STR_EQ;
+
        // find correct data line code number from string
           // function: getDataLineCode
        dataLineCode = getDataLineCode(dataBuffer);
 
-       // check for data line found
-       if (dataLineCode != CFG_CORRUPT_PROMPT_ERR)
+       // check for data line found, end line has no data to capture
+       if (!endLineFound && dataLineCode != CFG_CORRUPT_PROMPT_ERR)
          {
           // check for version number (double value)
           if (dataLineCode == CFG_VERSION_CODE)
@@ -214,11 +363,30 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
                    || dataLineCode == CFG_LOG_FILE_NAME_CODE
                       || dataLineCode == CFG_CPU_SCHED_CODE
                          || dataLineCode == CFG_LOG_TO_CODE
-                            || dataLineCode == CFG_MEM_DISPLAY_CODE)
+                            || dataLineCode == CFG_MEM_DISPLAY_CODE
+                            || dataLineCode == CFG_CLOCK_MODE_CODE
+                            || dataLineCode == CFG_TIMER_WAIT_CODE
+                            || dataLineCode == CFG_CPU_BATCHING_CODE
+                            || dataLineCode == CFG_INTERRUPT_DRAIN_CODE
+                            || dataLineCode == CFG_DISK_SCHED_CODE
+                            || dataLineCode == CFG_LOG_LEVEL_CODE
+                            || dataLineCode == CFG_LOG_PROCESSES_CODE
+                            || dataLineCode == CFG_LOG_EVENTS_CODE
+                            || dataLineCode == CFG_MEM_PLACEMENT_CODE)
             {          
-             // get string input
-                // function: fscanf
-             fscanf(fileAccessPtr, "%s", dataBuffer);
+             // get the event list as the rest of the line, it may hold
+             // spaces after its commas, other strings are single words
+                // function: getStringToLineEnd, stripTrailingSpaces, fscanf
+             if (dataLineCode == CFG_LOG_EVENTS_CODE)
+               {
+                getStringToLineEnd(fileAccessPtr, dataBuffer);
+
+                stripTrailingSpaces(dataBuffer);
+               }
+             else
+               {
+                fscanf(fileAccessPtr, "%s", dataBuffer);
+               }
 
              // set string to lower case for testing in valueInRange
                 // function: setStrToLowerCase
@@ -229,7 +397,7 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
             {
              // get integer input
                 // function: scanf
-             fscanf(fileAccessPtr, "%d", &intData);
+             fscanf(fileAccessPtr, "%lld", &intData);
             }
          
           // check for data value in range
@@ -284,6 +452,80 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
                 case CFG_LOG_FILE_NAME_CODE:
                    copyString(tempData->logToFileName, dataBuffer);
                    break;
+
+                case CFG_CLOCK_MODE_CODE:
+                   tempData->clockCode = getClockCode(lowerCaseDataBuffer);
+                   break;
+
+                case CFG_TIMER_WAIT_CODE:
+                   tempData->timerWaitCode 
+                                       = getTimerWaitCode(lowerCaseDataBuffer);
+                   break;
+
+                case CFG_SPIN_SLICE_CODE:
+                   tempData->spinSliceUSec = intData;
+                   break;
+
+                case CFG_TIME_SCALE_CODE:
+                   tempData->timeScale = intData;
+                   break;
+
+                case CFG_CPU_BATCHING_CODE:
+                   tempData->cpuBatching 
+                              = compareString(lowerCaseDataBuffer, "on" ) == 0;
+                   break;
+
+                case CFG_IO_WORKERS_CODE:
+                   tempData->ioWorkers = intData;
+                   break;
+
+                case CFG_INTERRUPT_DRAIN_CODE:
+                   tempData->interruptDrainCode 
+                                  = getInterruptDrainCode(lowerCaseDataBuffer);
+                   break;
+
+                case CFG_DISK_SCHED_CODE:
+                   tempData->diskSchedCode 
+                                       = getDiskSchedCode(lowerCaseDataBuffer);
+                   break;
+
+                case CFG_DISK_CYLINDERS_CODE:
+                   tempData->diskCylinders = intData;
+                   break;
+
+                case CFG_DISK_SEEK_CODE:
+                   tempData->diskSeekUSec = intData;
+                   break;
+
+                case CFG_LOG_LEVEL_CODE:
+                   tempData->logLevelCode 
+                                        = getLogLevelCode(lowerCaseDataBuffer);
+                   break;
+
+                case CFG_LOG_PROCESSES_CODE:
+                   getLogProcesses(lowerCaseDataBuffer, &tempData->logFirstPid,
+                                                        &tempData->logLastPid);
+                   break;
+
+                case CFG_LOG_EVENTS_CODE:
+                   tempData->logEventMask 
+                                        = getLogEventMask(lowerCaseDataBuffer);
+                   break;
+
+                case CFG_MEM_PLACEMENT_CODE:
+                   tempData->memPlacementCode 
+                                  = getMemPlacementCode(lowerCaseDataBuffer);
+                   break;
+
+                // device unit lines, one code per device
+                default:
+                   if (dataLineCode >= CFG_DEVICE_UNITS_CODE 
+                              && dataLineCode <= CFG_LAST_DEVICE_UNITS_CODE)
+                     {
+                      tempData->deviceUnits[dataLineCode 
+                                             - CFG_DEVICE_UNITS_CODE] = intData;
+                     }
+                   break;
                }
             }
           // otherwise assume data out of range
@@ -306,7 +548,7 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
             }
          }
        // otherwise, assume data not found
-       else
+       else if (!endLineFound)
          {
           // free temp struct memory
              // function: free
@@ -323,33 +565,43 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
           // return corrupt config file code
           return false;
          }
-       // increment line counter
-       lineCtr++;
+       // increment line counter for required items only
+       if (!endLineFound && dataLineCode < CFG_CLOCK_MODE_CODE)
+         {
+          lineCtr++;
+         }
       } // end master loop
    
-    // acquire end of sim config stream
-       // function: getStringToDelimiter, compareString
-    if (!getStringToDelimiter(fileAccessPtr, PERIOD, dataBuffer)||
-       compareString(dataBuffer, "End Simulator Configuration File") != STR_EQ)
+    // test for output without the monitor so memory diagnostics do not display
+    tempData->memDisplay = tempData->memDisplay
+                              && (tempData->logToCode == LOGTO_MONITOR_CODE
+                                  || tempData->logToCode == LOGTO_BOTH_CODE);
+
+    // the disk model queues the requests of blocked processes, so it needs
+    // a preemptive CPU scheduler, non-preemptive schedulers run each hard
+    // drive operation to completion at its flat device time, the model
+    // takes the place of the hard drive's device server and serves every
+    // request on a single head, so "Hard Drive Units" does not apply to it
+    if (tempData->diskSchedCode != DISK_NONE_CODE
+                        && (tempData->cpuSchedCode == CPU_SCHED_FCFS_N_CODE
+                           || tempData->cpuSchedCode == CPU_SCHED_SJF_N_CODE))
       {
        // free temp struct memory
           // function: free
        free(tempData);
-       
+
        // close file access
           // function: fclose
        fclose(fileAccessPtr);
 
-       // set end state message to corrupt configuration end line
+       // set end state message to disk model without preemption
           // function: copyString
-       copyString(endStateMsg, "Configuration end line capture error");
+       copyString(endStateMsg,
+                        "Disk scheduling requires a preemptive CPU scheduler");
 
-       // return corrupt file data
+       // return incompatible configuration
        return false;
       }
-    // test for "file only" output so memory diagnostics do not display
-    tempData->memDisplay = tempData->memDisplay 
-                                    && tempData->logToCode != LOGTO_FILE_CODE;
 
     // assign temporary pointer to parameter return pointer
     *configData = tempData;
@@ -362,6 +614,35 @@ bool getConfigData(const char *fileName, ConfigDataType **configData,
     return true;
    }
 
+/*
+Name: getClockCode
+Process: converts clock mode string to code (wall or virtual clock)
+Function Input/Parameters: lower case clock mode string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: clock mode code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getClockCode(const char *lowerCaseClockStr)
+   {
+    // initialize function/variables
+
+       // set default return to wall clock
+       ConfigDataCodes returnVal = CLOCK_WALL_CODE;
+
+    // check for virtual clock
+       // function: compareString
+    if (compareString(lowerCaseClockStr, "virtual") == STR_EQ)
+      {
+       // set virtual clock code
+       returnVal = CLOCK_VIRTUAL_CODE;
+      }
+
+    // return selected code
+    return returnVal;
+   }
+
 /*
 Name: getCpuSchedCode
 Process: converts cpu schedule string to code (all scheduling possibilities)
@@ -426,6 +707,10 @@ Dependencies:  compareString
 */
 ConfigCodeMessages getDataLineCode( const char *dataBuffer)
    {
+    // initialize function/variables
+    char lowerCaseLeader[MAX_STR_LEN], deviceLeader[MAX_STR_LEN];
+    int deviceCode;
+
     // return appropriate code depending on prompt string provided
        // function: compareString
     if (compareString(dataBuffer, "Version/Phase") == STR_EQ)
@@ -478,42 +763,181 @@ ConfigCodeMessages getDataLineCode( const char *dataBuffer)
        return CFG_LOG_FILE_NAME_CODE;
       }
 
+    if (compareString(dataBuffer, "Clock Mode (Wall/Virtual)") == STR_EQ)
+      {
+       return CFG_CLOCK_MODE_CODE;
+      }
+
+    if (compareString(dataBuffer, "Timer Wait (Spin/Sleep/Hybrid)") == STR_EQ)
+      {
+       return CFG_TIMER_WAIT_CODE;
+      }
+
+    if (compareString(dataBuffer, "Timer Spin Slice (usec)") == STR_EQ)
+      {
+       return CFG_SPIN_SLICE_CODE;
+      }
+
+    if (compareString(dataBuffer, "Time Scale") == STR_EQ)
+      {
+       return CFG_TIME_SCALE_CODE;
+      }
+
+    if (compareString(dataBuffer, "CPU Batching (On/Off)") == STR_EQ)
+      {
+       return CFG_CPU_BATCHING_CODE;
+      }
+
+    if (compareString(dataBuffer, "I/O Workers") == STR_EQ)
+      {
+       return CFG_IO_WORKERS_CODE;
+      }
+
+    if (compareString(dataBuffer, "Interrupt Drain (Single/Batch)") == STR_EQ)
+      {
+       return CFG_INTERRUPT_DRAIN_CODE;
+      }
+
+    if (compareString(dataBuffer, 
+                    "Disk Scheduling (None/FCFS/SSTF/SCAN/C-LOOK)") == STR_EQ)
+      {
+       return CFG_DISK_SCHED_CODE;
+      }
+
+    if (compareString(dataBuffer, "Disk Cylinders") == STR_EQ)
+      {
+       return CFG_DISK_CYLINDERS_CODE;
+      }
+
+    if (compareString(dataBuffer, "Disk Seek Time (usec/cylinder)") == STR_EQ)
+      {
+       return CFG_DISK_SEEK_CODE;
+      }
+
+    if (compareString(dataBuffer, "Log Level (OS/Process/Op/Memory)") == STR_EQ)
+      {
+       return CFG_LOG_LEVEL_CODE;
+      }
+
+    if (compareString(dataBuffer, "Log Processes") == STR_EQ)
+      {
+       return CFG_LOG_PROCESSES_CODE;
+      }
+
+    if (compareString(dataBuffer, "Log Events") == STR_EQ)
+      {
+       return CFG_LOG_EVENTS_CODE;
+      }
+
+    if (compareString(dataBuffer,
+                   "Memory Placement (Exact/First/Best/Next/Buddy)") == STR_EQ)
+      {
+       return CFG_MEM_PLACEMENT_CODE;
+      }
+
+    // check for a device units line, led by the device name then "Units"
+       // function: setStrToLowerCase, deviceCodeToString, concatenateString
+    setStrToLowerCase(lowerCaseLeader, dataBuffer);
+
+    for (deviceCode = 0; deviceCode < DEVICE_COUNT; deviceCode++)
+      {
+       deviceCodeToString(deviceCode, deviceLeader);
+
+       concatenateString(deviceLeader, " units");
+
+       if (compareString(lowerCaseLeader, deviceLeader) == STR_EQ)
+         {
+          return CFG_DEVICE_UNITS_CODE + deviceCode;
+         }
+      }
+
     // return corrupt leader line error
     return CFG_CORRUPT_PROMPT_ERR;
 
    }
 
 /*
-Name: getLogToCode
-Process: 
-Function Input/Parameters: lower case log to str (const char *)
+Name: getDeviceCode
+Process: converts a dev operation device name to its device code
+Function Input/Parameters: device name (const char *)
 Function Output/Parameters: none
-Function Output/Returned: string code ( ConfigDataCodes)
+Function Output/Returned: device code, DEVICE_COUNT if not a device (int)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString, deviceCodeToString
+*/
+int getDeviceCode(const char *deviceStr)
+   {
+    // initialize function/variables
+    char deviceName[STD_STR_LEN];
+    int deviceCode;
+
+    // loop across the device names
+    for (deviceCode = 0; deviceCode < DEVICE_COUNT; deviceCode++)
+      {
+       deviceCodeToString(deviceCode, deviceName);
+
+       // check for matching device
+          // function: compareString
+       if (compareString(deviceStr, deviceName) == STR_EQ)
+         {
+          // return found device code
+          return deviceCode;
+         }
+      }
+
+    // return not found
+    return DEVICE_COUNT;
+   }
+
+/*
+Name: getDiskSchedCode
+Process: converts disk scheduling string to code (none, FCFS, SSTF, 
+         SCAN or C-LOOK)
+Function Input/Parameters: lower case disk scheduling string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: disk scheduling code (ConfigDataCodes)
 Device Input/Keyboard: none
 Device Output/Monitor: none
 Dependencies: compareString
 */
-ConfigDataCodes getLogToCode(const char *lowerCaseLogToStr)
+ConfigDataCodes getDiskSchedCode(const char *lowerCaseDiskStr)
    {
     // initialize function/variables
 
-       // set to default log to monitor
-       ConfigDataCodes returnVal = LOGTO_MONITOR_CODE;
+       // set default return to no disk model
+       ConfigDataCodes returnVal = DISK_NONE_CODE;
 
-    // check for BOTH
-       // function: stringCompare
-    if (compareString(lowerCaseLogToStr, "both") == STR_EQ)
+    // check for FCFS
+       // function: compareString
+    if (compareString(lowerCaseDiskStr, "fcfs") == STR_EQ)
       {
-       // set return value to both code
-       returnVal = LOGTO_BOTH_CODE;
+       // set FCFS code
+       returnVal = DISK_FCFS_CODE;
       }
 
-    // check for FILE
+    // check for SSTF
        // function: compareString
-    if (compareString(lowerCaseLogToStr, "file") == STR_EQ)
+    if (compareString(lowerCaseDiskStr, "sstf") == STR_EQ)
       {
-       // set return value to file code
-       returnVal = LOGTO_FILE_CODE;
+       // set SSTF code
+       returnVal = DISK_SSTF_CODE;
+      }
+
+    // check for SCAN
+       // function: compareString
+    if (compareString(lowerCaseDiskStr, "scan") == STR_EQ)
+      {
+       // set SCAN code
+       returnVal = DISK_SCAN_CODE;
+      }
+
+    // check for C-LOOK
+       // function: compareString
+    if (compareString(lowerCaseDiskStr, "c-look") == STR_EQ)
+      {
+       // set C-LOOK code
+       returnVal = DISK_CLOOK_CODE;
       }
 
     // return selected code
@@ -521,75 +945,453 @@ ConfigDataCodes getLogToCode(const char *lowerCaseLogToStr)
    }
 
 /*
-Name: stripTrailingSpaces
-Process: removes trailing spaces from input config leader lines
-Function Input/Parameters: config leader line string (char *)
-Function Output/Parameters: updated config leader line string (char *)
-Function Output/Returned: none
+Name: getInterruptDrainCode
+Process: converts interrupt drain string to code (single or batch)
+Function Input/Parameters: lower case interrupt drain string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: interrupt drain code (ConfigDataCodes)
 Device Input/Keyboard: none
 Device Output/Monitor: none
-Dependencies: getStringLength
+Dependencies: compareString
 */
-void stripTrailingSpaces(char *str)
+ConfigDataCodes getInterruptDrainCode(const char *lowerCaseDrainStr)
    {
-    // initialize index to length of string - 1 to get highest array index
-    int index = getStringLength(str) - 1;
+    // initialize function/variables
 
-    // loop while space is found at end of string
-    while (str[index] == SPACE)
-      {
-       // set element to NULL_CHAR
-       str[index] = NULL_CHAR;
+       // set default return to single interrupt handling
+       ConfigDataCodes returnVal = INTERRUPT_SINGLE_CODE;
 
-       // decrement index
-       index--;
+    // check for batch draining
+       // function: compareString
+    if (compareString(lowerCaseDrainStr, "batch") == STR_EQ)
+      {
+       // set batch drain code
+       returnVal = INTERRUPT_BATCH_CODE;
       }
 
-    // end loop from end of string
+    // return selected code
+    return returnVal;
    }
 
 /*
-Name: valueInRange
-Process: checks for config data values in range, including string values
-         (all config data values)
-Function Input/Parameters: line code number for specific config value (int),
-                           integer value, as needed (int)
-                           double value, as needed (double)
-                           string value, as needed (const char *)
+Name: getLogEventMask
+Process: converts a comma separated list of logged event classes (state,
+         cpu, io, mem) or all to an event class mask, spaces around the
+         commas are ignored
+Function Input/Parameters: lower case log events string (const char *)
 Function Output/Parameters: none
-Function Output/Returned: Boolean result of range test (bool)
+Function Output/Returned: event class mask, LOG_EVENT_NONE if the list
+                          is not valid (int)
 Device Input/Keyboard: none
 Device Output/Monitor: none
-Dependencies: compareString
+Dependencies: compareString, stripTrailingSpaces
 */
-bool valueInRange(int lineCode, int intVal,
-                              double doubleVal, const char *lowerCaseStringVal)
+int getLogEventMask(const char *lowerCaseEventsStr)
    {
     // initialize function/variables
+    char eventStr[STD_STR_LEN];
+    int eventMask = LOG_EVENT_NONE, strIndex = 0, eventIndex;
 
-       // set result to true, all tests are to find false
-       bool result = true;
+    // check for every event
+       // function: compareString
+    if (compareString(lowerCaseEventsStr, "all") == STR_EQ)
+      {
+       return LOG_EVENT_ALL;
+      }
 
-    // use line code to identify prompt line
-    switch (lineCode)
+    // loop across the comma separated event names
+    while (lowerCaseEventsStr[strIndex] != NULL_CHAR)
       {
-       // for version code
-       case CFG_VERSION_CODE:
-          // check if limits of version code are exceeded
-          if (doubleVal < 0.00 || doubleVal > 10.00)
-            {
-             // set boolean to false
-             result = false;
-            }
+       // copy the next event name
+       eventIndex = 0;
 
-          // break
-          break;
+       while (lowerCaseEventsStr[strIndex] != NULL_CHAR 
+                  && lowerCaseEventsStr[strIndex] != COMMA
+                                          && eventIndex < STD_STR_LEN - 1)
+         {
+          eventStr[eventIndex] = lowerCaseEventsStr[strIndex];
 
-       // for cpu scheduling code
-       case CFG_CPU_SCHED_CODE:
+          eventIndex++;
 
-          // check for not finding one of the scheduling strings
-             // function: compareString
+          strIndex++;
+         }
+
+       eventStr[eventIndex] = NULL_CHAR;
+
+       // drop spaces before the comma
+          // function: stripTrailingSpaces
+       stripTrailingSpaces(eventStr);
+
+       // add its class to the mask
+          // function: compareString
+       if (compareString(eventStr, "state") == STR_EQ)
+         {
+          eventMask |= LOG_EVENT_STATE;
+         }
+
+       else if (compareString(eventStr, "cpu") == STR_EQ)
+         {
+          eventMask |= LOG_EVENT_CPU;
+         }
+
+       else if (compareString(eventStr, "io") == STR_EQ)
+         {
+          eventMask |= LOG_EVENT_IO;
+         }
+
+       else if (compareString(eventStr, "mem") == STR_EQ)
+         {
+          eventMask |= LOG_EVENT_MEMORY;
+         }
+
+       // any other name makes the list invalid
+       else
+         {
+          return LOG_EVENT_NONE;
+         }
+
+       // skip the comma and the spaces after it
+       if (lowerCaseEventsStr[strIndex] == COMMA)
+         {
+          strIndex++;
+
+          while (lowerCaseEventsStr[strIndex] == SPACE)
+            {
+             strIndex++;
+            }
+         }
+      }
+
+    // return the event class mask
+    return eventMask;
+   }
+
+/*
+Name: getLogLevelCode
+Process: converts log level string to code (OS, process, op or memory)
+Function Input/Parameters: lower case log level string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: log level code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getLogLevelCode(const char *lowerCaseLevelStr)
+   {
+    // initialize function/variables
+
+       // set default to log everything
+       ConfigDataCodes returnVal = LOG_LEVEL_MEMORY_CODE;
+
+    // check for OS
+       // function: compareString
+    if (compareString(lowerCaseLevelStr, "os") == STR_EQ)
+      {
+       // set OS only code
+       returnVal = LOG_LEVEL_OS_CODE;
+      }
+
+    // check for process
+       // function: compareString
+    if (compareString(lowerCaseLevelStr, "process") == STR_EQ)
+      {
+       // set process level code
+       returnVal = LOG_LEVEL_PROCESS_CODE;
+      }
+
+    // check for op
+       // function: compareString
+    if (compareString(lowerCaseLevelStr, "op") == STR_EQ)
+      {
+       // set op level code
+       returnVal = LOG_LEVEL_OP_CODE;
+      }
+
+    // return selected code
+    return returnVal;
+   }
+
+/*
+Name: getLogProcesses
+Process: converts a logged process string (all, one id, a first-last
+         range of ids, or a first- range of that id and up) to its first
+         and last process id
+Function Input/Parameters: lower case log processes string (const char *)
+Function Output/Parameters: first and last logged process ids (int *),
+                            last is LOG_ALL_PROCESSES for an open range
+Function Output/Returned: Boolean result of the conversion (bool)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString, sscanf
+*/
+bool getLogProcesses(const char *lowerCaseProcessStr, int *firstPid, 
+                                                               int *lastPid)
+   {
+    // initialize function/variables
+    int first, last;
+    char extraChar;
+
+    // check for every process
+       // function: compareString
+    if (compareString(lowerCaseProcessStr, "all") == STR_EQ)
+      {
+       *firstPid = 0;
+       *lastPid = LOG_ALL_PROCESSES;
+
+       return true;
+      }
+
+    // check for a first-last range
+       // function: sscanf
+    if (sscanf(lowerCaseProcessStr, "%d-%d%c", &first, &last, &extraChar) == 2)
+      {
+       *firstPid = first;
+       *lastPid = last;
+
+       return first >= 0 && last >= first;
+      }
+
+    // check for a single process
+       // function: sscanf
+    if (sscanf(lowerCaseProcessStr, "%d%c", &first, &extraChar) == 1)
+      {
+       *firstPid = first;
+       *lastPid = first;
+
+       return first >= 0;
+      }
+
+    // check for a first- open range, a single id matched above
+       // function: sscanf
+    if (sscanf(lowerCaseProcessStr, "%d-%c", &first, &extraChar) == 1)
+      {
+       *firstPid = first;
+       *lastPid = LOG_ALL_PROCESSES;
+
+       return first >= 0;
+      }
+
+    // return invalid process string
+    return false;
+   }
+
+/*
+Name: getLogToCode
+Process: 
+Function Input/Parameters: lower case log to str (const char *)
+Function Output/Parameters: none
+Function Output/Returned: string code ( ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getLogToCode(const char *lowerCaseLogToStr)
+   {
+    // initialize function/variables
+
+       // set to default log to monitor
+       ConfigDataCodes returnVal = LOGTO_MONITOR_CODE;
+
+    // check for BOTH
+       // function: stringCompare
+    if (compareString(lowerCaseLogToStr, "both") == STR_EQ)
+      {
+       // set return value to both code
+       returnVal = LOGTO_BOTH_CODE;
+      }
+
+    // check for FILE
+       // function: compareString
+    if (compareString(lowerCaseLogToStr, "file") == STR_EQ)
+      {
+       // set return value to file code
+       returnVal = LOGTO_FILE_CODE;
+      }
+
+    // check for TRACE
+       // function: compareString
+    if (compareString(lowerCaseLogToStr, "trace") == STR_EQ)
+      {
+       // set return value to binary trace code
+       returnVal = LOGTO_TRACE_CODE;
+      }
+
+    // check for CHROME
+       // function: compareString
+    if (compareString(lowerCaseLogToStr, "chrome") == STR_EQ)
+      {
+       // set return value to trace viewer code
+       returnVal = LOGTO_CHROME_CODE;
+      }
+
+    // return selected code
+    return returnVal;
+   }
+
+/*
+Name: getMemPlacementCode
+Process: converts memory placement string to code (exact, first, best, 
+         next or buddy)
+Function Input/Parameters: lower case memory placement string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: memory placement code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getMemPlacementCode(const char *lowerCasePlacementStr)
+   {
+    // initialize function/variables
+
+       // set default to the base named by the allocate request
+       ConfigDataCodes returnVal = MEM_PLACE_EXACT_CODE;
+
+    // check for first fit
+       // function: compareString
+    if (compareString(lowerCasePlacementStr, "first") == STR_EQ)
+      {
+       // set first fit code
+       returnVal = MEM_PLACE_FIRST_FIT_CODE;
+      }
+
+    // check for best fit
+       // function: compareString
+    if (compareString(lowerCasePlacementStr, "best") == STR_EQ)
+      {
+       // set best fit code
+       returnVal = MEM_PLACE_BEST_FIT_CODE;
+      }
+
+    // check for next fit
+       // function: compareString
+    if (compareString(lowerCasePlacementStr, "next") == STR_EQ)
+      {
+       // set next fit code
+       returnVal = MEM_PLACE_NEXT_FIT_CODE;
+      }
+
+    // check for the buddy system
+       // function: compareString
+    if (compareString(lowerCasePlacementStr, "buddy") == STR_EQ)
+      {
+       // set buddy system code
+       returnVal = MEM_PLACE_BUDDY_CODE;
+      }
+
+    // return selected code
+    return returnVal;
+   }
+
+/*
+Name: getTimerWaitCode
+Process: converts timer wait string to code (spin, sleep or hybrid)
+Function Input/Parameters: lower case timer wait string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: timer wait code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getTimerWaitCode(const char *lowerCaseWaitStr)
+   {
+    // initialize function/variables
+
+       // set default return to spin wait
+       ConfigDataCodes returnVal = TIMER_SPIN_CODE;
+
+    // check for SLEEP
+       // function: compareString
+    if (compareString(lowerCaseWaitStr, "sleep") == STR_EQ)
+      {
+       // set sleep wait code
+       returnVal = TIMER_SLEEP_CODE;
+      }
+
+    // check for HYBRID
+       // function: compareString
+    if (compareString(lowerCaseWaitStr, "hybrid") == STR_EQ)
+      {
+       // set hybrid wait code
+       returnVal = TIMER_HYBRID_CODE;
+      }
+
+    // return selected code
+    return returnVal;
+   }
+
+/*
+Name: stripTrailingSpaces
+Process: removes trailing spaces from input config leader lines
+Function Input/Parameters: config leader line string (char *)
+Function Output/Parameters: updated config leader line string (char *)
+Function Output/Returned: none
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: getStringLength
+*/
+void stripTrailingSpaces(char *str)
+   {
+    // initialize index to length of string - 1 to get highest array index
+    int index = getStringLength(str) - 1;
+
+    // loop while space is found at end of string
+    while (str[index] == SPACE)
+      {
+       // set element to NULL_CHAR
+       str[index] = NULL_CHAR;
+
+       // decrement index
+       index--;
+      }
+
+    // end loop from end of string
+   }
+
+/*
+Name: valueInRange
+Process: checks for config data values in range, including string values
+         (all config data values)
+Function Input/Parameters: line code number for specific config value (int),
+                           integer value, as needed (long long)
+                           double value, as needed (double)
+                           string value, as needed (const char *)
+Function Output/Parameters: none
+Function Output/Returned: Boolean result of range test (bool)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+bool valueInRange(int lineCode, long long intVal,
+                              double doubleVal, const char *lowerCaseStringVal)
+   {
+    // initialize function/variables
+
+       // set result to true, all tests are to find false
+       bool result = true;
+
+       // process range converted while checking logged processes
+       int first, last;
+
+    // use line code to identify prompt line
+    switch (lineCode)
+      {
+       // for version code
+       case CFG_VERSION_CODE:
+          // check if limits of version code are exceeded
+          if (doubleVal < 0.00 || doubleVal > 10.00)
+            {
+             // set boolean to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // for cpu scheduling code
+       case CFG_CPU_SCHED_CODE:
+
+          // check for not finding one of the scheduling strings
+             // function: compareString
           if (compareString(lowerCaseStringVal, "fcfs-n") != STR_EQ
               && compareString(lowerCaseStringVal, "sjf-n") != STR_EQ
               && compareString(lowerCaseStringVal, "srtf-p") != STR_EQ
@@ -616,8 +1418,9 @@ bool valueInRange(int lineCode, int intVal,
           // break
           break;
       
-       // for memory display
+       // for memory display or cpu batching
        case CFG_MEM_DISPLAY_CODE:
+       case CFG_CPU_BATCHING_CODE:
 
           // check for not finding either "on" or "off"
              // function: compareString
@@ -635,7 +1438,7 @@ bool valueInRange(int lineCode, int intVal,
        case CFG_MEM_AVAILABLE_CODE:
 
           // check for available memory limits exceeded
-          if (intVal < 1024 || intVal > 102400)
+          if (intVal < MEM_MIN || intVal > MEM_MAX)
             {
              // set Boolean result to false
              result = false;
@@ -677,7 +1480,9 @@ bool valueInRange(int lineCode, int intVal,
              // function: compareString
           if (compareString(lowerCaseStringVal, "both") != STR_EQ
               && compareString(lowerCaseStringVal, "monitor") != STR_EQ
-              && compareString(lowerCaseStringVal, "file") != STR_EQ)
+              && compareString(lowerCaseStringVal, "file") != STR_EQ
+              && compareString(lowerCaseStringVal, "trace") != STR_EQ
+              && compareString(lowerCaseStringVal, "chrome") != STR_EQ)
             {
              // set boolean result to false
              result = false;
@@ -685,6 +1490,213 @@ bool valueInRange(int lineCode, int intVal,
 
           // break
           break;
+
+       // check for clock mode
+       case CFG_CLOCK_MODE_CODE:
+
+          // check for not finding either "wall" or "virtual"
+             // function: compareString
+          if (compareString(lowerCaseStringVal, "wall") != STR_EQ
+              && compareString(lowerCaseStringVal, "virtual") != STR_EQ)
+            {
+             // set boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for disk scheduling
+       case CFG_DISK_SCHED_CODE:
+
+          // check for not finding one of the disk scheduling strings
+             // function: compareString
+          if (compareString(lowerCaseStringVal, "none") != STR_EQ
+              && compareString(lowerCaseStringVal, "fcfs") != STR_EQ
+              && compareString(lowerCaseStringVal, "sstf") != STR_EQ
+              && compareString(lowerCaseStringVal, "scan") != STR_EQ
+              && compareString(lowerCaseStringVal, "c-look") != STR_EQ)
+            {
+             // set boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for disk cylinders
+       case CFG_DISK_CYLINDERS_CODE:
+
+          // check for disk cylinder limits exceeded
+          if (intVal < 1 || intVal > 100000)
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for disk seek time
+       case CFG_DISK_SEEK_CODE:
+
+          // check for seek time limits exceeded (up to one second)
+          if (intVal < 0 || intVal > 1000000)
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for interrupt drain
+       case CFG_INTERRUPT_DRAIN_CODE:
+
+          // check for not finding either "single" or "batch"
+             // function: compareString
+          if (compareString(lowerCaseStringVal, "single") != STR_EQ
+              && compareString(lowerCaseStringVal, "batch") != STR_EQ)
+            {
+             // set boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for timer wait strategy
+       case CFG_TIMER_WAIT_CODE:
+
+          // check for not finding one of the timer wait strings
+             // function: compareString
+          if (compareString(lowerCaseStringVal, "spin") != STR_EQ
+              && compareString(lowerCaseStringVal, "sleep") != STR_EQ
+              && compareString(lowerCaseStringVal, "hybrid") != STR_EQ)
+            {
+             // set boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for timer spin slice
+       case CFG_SPIN_SLICE_CODE:
+
+          // check for spin slice limits exceeded (up to one second)
+          if (intVal < 0 || intVal > 1000000)
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for time scale
+       case CFG_TIME_SCALE_CODE:
+
+          // check for time scale limits exceeded
+          if (intVal < 1 || intVal > 10000)
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for io workers, zero selects one per processor core
+       case CFG_IO_WORKERS_CODE:
+
+          // check for io worker limits exceeded
+          if (intVal < 0 || intVal > 64)
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for log level
+       case CFG_LOG_LEVEL_CODE:
+
+          // check for not finding one of the log levels
+             // function: compareString
+          if (compareString(lowerCaseStringVal, "os") != STR_EQ
+              && compareString(lowerCaseStringVal, "process") != STR_EQ
+              && compareString(lowerCaseStringVal, "op") != STR_EQ
+              && compareString(lowerCaseStringVal, "memory") != STR_EQ)
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for logged processes
+       case CFG_LOG_PROCESSES_CODE:
+
+          // check for a process string that does not convert
+             // function: getLogProcesses
+          if (!getLogProcesses(lowerCaseStringVal, &first, &last))
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for logged events
+       case CFG_LOG_EVENTS_CODE:
+
+          // check for an event list that does not convert
+             // function: getLogEventMask
+          if (getLogEventMask(lowerCaseStringVal) == LOG_EVENT_NONE)
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for memory placement
+       case CFG_MEM_PLACEMENT_CODE:
+
+          // check for not finding one of the placement strings
+             // function: compareString
+          if (compareString(lowerCaseStringVal, "exact") != STR_EQ
+              && compareString(lowerCaseStringVal, "first") != STR_EQ
+              && compareString(lowerCaseStringVal, "best") != STR_EQ
+              && compareString(lowerCaseStringVal, "next") != STR_EQ
+              && compareString(lowerCaseStringVal, "buddy") != STR_EQ)
+            {
+             // set boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
+
+       // check for device units, zero leaves the device unlimited
+       default:
+
+          // check for device unit limits exceeded
+          if (lineCode >= CFG_DEVICE_UNITS_CODE 
+                 && lineCode <= CFG_LAST_DEVICE_UNITS_CODE
+                    && (intVal < 0 || intVal > 64))
+            {
+             // set Boolean result to false
+             result = false;
+            }
+
+          // break
+          break;
       }
 
     // return result of limits analysis
@@ -6,6 +6,29 @@
 #include "StandardConstants.h"
 #include "stringUtil.h"
 
+// io devices named by dev operations, in alphabetical order
+typedef enum { ETHERNET_DEVICE,
+               HARD_DRIVE_DEVICE,
+               KEYBOARD_DEVICE,
+               MONITOR_DEVICE,
+               PRINTER_DEVICE,
+               SERIAL_DEVICE,
+               SOUND_SIGNAL_DEVICE,
+               USB_DEVICE,
+               VIDEO_SIGNAL_DEVICE,
+               DEVICE_COUNT } DeviceCodes;
+
+// classes of process event that can be logged, combined as a mask
+typedef enum { LOG_EVENT_NONE   = 0,
+               LOG_EVENT_STATE  = 1,
+               LOG_EVENT_CPU    = 2,
+               LOG_EVENT_IO     = 4,
+               LOG_EVENT_MEMORY = 8,
+               LOG_EVENT_ALL    = 15 } LogEventClasses;
+
+// last logged process id that leaves the range open
+#define LOG_ALL_PROCESSES -1
+
 typedef struct ConfigDataStruct
    {
     char metaDataFileName[MAX_STR_LEN];
@@ -14,15 +37,31 @@ typedef struct ConfigDataStruct
     char logTo[STD_STR_LEN];
 
     bool memDisplay;
+    bool cpuBatching;
 
     double version;
     
     int quantumCycles;
-    int memAvailable;
+    long long memAvailable;
     int procCycleRate;
     int ioCycleRate;
     int logToCode;
     int cpuSchedCode;
+    int clockCode;
+    int timerWaitCode;
+    int spinSliceUSec;
+    int timeScale;
+    int ioWorkers;
+    int interruptDrainCode;
+    int deviceUnits[DEVICE_COUNT];
+    int diskSchedCode;
+    int diskCylinders;
+    int diskSeekUSec;
+    int logLevelCode;
+    int logFirstPid;
+    int logLastPid;
+    int logEventMask;
+    int memPlacementCode;
 
    } ConfigDataType;
 
@@ -36,7 +75,30 @@ typedef enum {  CPU_SCHED_SJF_N_CODE,
                 LOGTO_FILE_CODE,
                 LOGTO_BOTH_CODE, 
                 NON_PREEMPTIVE_CODE, 
-                PREEMPTIVE_CODE } ConfigDataCodes;
+                PREEMPTIVE_CODE,
+                CLOCK_WALL_CODE,
+                CLOCK_VIRTUAL_CODE,
+                TIMER_SPIN_CODE,
+                TIMER_SLEEP_CODE,
+                TIMER_HYBRID_CODE,
+                INTERRUPT_SINGLE_CODE,
+                INTERRUPT_BATCH_CODE,
+                DISK_NONE_CODE,
+                DISK_FCFS_CODE,
+                DISK_SSTF_CODE,
+                DISK_SCAN_CODE,
+                DISK_CLOOK_CODE,
+                LOGTO_TRACE_CODE,
+                LOGTO_CHROME_CODE,
+                LOG_LEVEL_OS_CODE,
+                LOG_LEVEL_PROCESS_CODE,
+                LOG_LEVEL_OP_CODE,
+                LOG_LEVEL_MEMORY_CODE,
+                MEM_PLACE_EXACT_CODE,
+                MEM_PLACE_FIRST_FIT_CODE,
+                MEM_PLACE_BEST_FIT_CODE,
+                MEM_PLACE_NEXT_FIT_CODE,
+                MEM_PLACE_BUDDY_CODE } ConfigDataCodes;
 
 typedef enum { CFG_FILE_ACCESS_ERR, 
                CFG_CORRUPT_DESCRIPTOR_ERR, 
@@ -51,7 +113,24 @@ typedef enum { CFG_FILE_ACCESS_ERR,
                CFG_PROC_CYCLES_CODE, 
                CFG_IO_CYCLES_CODE,
                CFG_LOG_TO_CODE, 
-               CFG_LOG_FILE_NAME_CODE } ConfigCodeMessages;
+               CFG_LOG_FILE_NAME_CODE,
+               CFG_CLOCK_MODE_CODE,
+               CFG_TIMER_WAIT_CODE,
+               CFG_SPIN_SLICE_CODE,
+               CFG_TIME_SCALE_CODE,
+               CFG_CPU_BATCHING_CODE,
+               CFG_IO_WORKERS_CODE,
+               CFG_INTERRUPT_DRAIN_CODE,
+               CFG_DEVICE_UNITS_CODE,
+               CFG_LAST_DEVICE_UNITS_CODE 
+                         = CFG_DEVICE_UNITS_CODE + DEVICE_COUNT - 1,
+               CFG_DISK_SCHED_CODE,
+               CFG_DISK_CYLINDERS_CODE,
+               CFG_DISK_SEEK_CODE,
+               CFG_LOG_LEVEL_CODE,
+               CFG_LOG_PROCESSES_CODE,
+               CFG_LOG_EVENTS_CODE,
+               CFG_MEM_PLACEMENT_CODE } ConfigCodeMessages;
 
 //  function prototypes
 
@@ -80,6 +159,19 @@ Dependencies: copyString
 */
 void configCodeToString(int code, char *outString);
 
+/*
+Name: deviceCodeToString
+Process: utility function converts device code numbers
+         to the device names used by dev operations
+Function Input/Parameters: device code (int)
+Function Output/Parameters: resulting device name (char *)
+Function Output/Returned: none
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: copyString
+*/
+void deviceCodeToString(int code, char *outString);
+
 /*
 Name: displayConfigData
 Process: scree dump/display of all config data
@@ -106,6 +198,18 @@ Dependencies: tbd
 bool getConfigData(const char *fileName, ConfigDataType **configData, 
                                                             char *endStateMsg);
 
+/*
+Name: getClockCode
+Process: converts clock mode string to code (wall or virtual clock)
+Function Input/Parameters: lower case clock mode string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: clock mode code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getClockCode(const char *lowerCaseClockStr);
+
 /*
 Name: getCpuSchedCode
 Process: converts cpu schedule string to code (all scheduling possibilities)
@@ -131,6 +235,86 @@ Dependencies:  compareString
 */
 ConfigCodeMessages getDataLineCode( const char *dataBuffer);
 
+/*
+Name: getDeviceCode
+Process: converts a dev operation device name to its device code
+Function Input/Parameters: device name (const char *)
+Function Output/Parameters: none
+Function Output/Returned: device code, DEVICE_COUNT if not a device (int)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString, deviceCodeToString
+*/
+int getDeviceCode(const char *deviceStr);
+
+/*
+Name: getDiskSchedCode
+Process: converts disk scheduling string to code (none, FCFS, SSTF, 
+         SCAN or C-LOOK)
+Function Input/Parameters: lower case disk scheduling string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: disk scheduling code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getDiskSchedCode(const char *lowerCaseDiskStr);
+
+/*
+Name: getInterruptDrainCode
+Process: converts interrupt drain string to code (single or batch)
+Function Input/Parameters: lower case interrupt drain string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: interrupt drain code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getInterruptDrainCode(const char *lowerCaseDrainStr);
+
+/*
+Name: getLogEventMask
+Process: converts a comma separated list of logged event classes (state,
+         cpu, io, mem) or all to an event class mask, spaces around the
+         commas are ignored
+Function Input/Parameters: lower case log events string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: event class mask, LOG_EVENT_NONE if the list
+                          is not valid (int)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString, stripTrailingSpaces
+*/
+int getLogEventMask(const char *lowerCaseEventsStr);
+
+/*
+Name: getLogLevelCode
+Process: converts log level string to code (OS, process, op or memory)
+Function Input/Parameters: lower case log level string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: log level code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getLogLevelCode(const char *lowerCaseLevelStr);
+
+/*
+Name: getLogProcesses
+Process: converts a logged process string (all, one id, a first-last
+         range of ids, or a first- range of that id and up) to its first
+         and last process id
+Function Input/Parameters: lower case log processes string (const char *)
+Function Output/Parameters: first and last logged process ids (int *),
+                            last is LOG_ALL_PROCESSES for an open range
+Function Output/Returned: Boolean result of the conversion (bool)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString, sscanf
+*/
+bool getLogProcesses(const char *lowerCaseProcessStr, int *firstPid, 
+                                                               int *lastPid);
+
 /*
 Name: getLogToCode
 Process: 
@@ -143,6 +327,31 @@ Dependencies: compareString
 */
 ConfigDataCodes getLogToCode(const char *lowerCaseLogToStr);
 
+/*
+Name: getMemPlacementCode
+Process: converts memory placement string to code (exact, first, best, 
+         next or buddy)
+Function Input/Parameters: lower case memory placement string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: memory placement code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getMemPlacementCode(const char *lowerCasePlacementStr);
+
+/*
+Name: getTimerWaitCode
+Process: converts timer wait string to code (spin, sleep or hybrid)
+Function Input/Parameters: lower case timer wait string (const char *)
+Function Output/Parameters: none
+Function Output/Returned: timer wait code (ConfigDataCodes)
+Device Input/Keyboard: none
+Device Output/Monitor: none
+Dependencies: compareString
+*/
+ConfigDataCodes getTimerWaitCode(const char *lowerCaseWaitStr);
+
 /*
 Name: stripTrailingSpaces
 Process: removes trailing spaces from input config leader lines
@@ -160,7 +369,7 @@ Name: valueInRange
 Process: checks for config data values in range, including string values
          (all config data values)
 Function Input/Parameters: line code number for specific config value (int),
-                           integer value, as needed (int)
+                           integer value, as needed (long long)
                            double value, as needed (double)
                            string value, as needed (const char *)
 Function Output/Parameters: none
@@ -169,7 +378,7 @@ Device Input/Keyboard: none
 Device Output/Monitor: none
 Dependencies: compareString
 */
-bool valueInRange(int lineCode, int intVal,
+bool valueInRange(int lineCode, long long intVal,
                               double doubleVal, const char *lowerCaseStringVal);
 
 #endif // CONFIGOPS_H
\ No newline at end of file
@@ -135,11 +135,11 @@ void displayMetaData(const OpCodeType *localPtr)
 
        // print first int argument
           // function: printf
-       printf("/arg2: %d", localPtr->intArg2);
+       printf("/arg2: %lld", localPtr->intArg2);
 
        // print second int argument
           // function: printf
-       printf("/arg3: %d", localPtr->intArg3);
+       printf("/arg3: %lld", localPtr->intArg3);
 
        // print op end time
        printf("/op end time: %8.6f", localPtr->opEndTime);
@@ -426,7 +426,7 @@ OpCodeMessages getOpCommand(FILE *filePtr, OpCodeType *inData)
        const int MAX_ARG_STRING_LENGTH = 15;
 
        // initialize other variables
-       int numBuffer = 0;
+       long long numBuffer = 0;
        char strBuffer[STD_STR_LEN];
        char cmdBuffer[MAX_CMD_LENGTH];
        char argStrBuffer[MAX_ARG_STRING_LENGTH];
@@ -570,6 +570,33 @@ OpCodeMessages getOpCommand(FILE *filePtr, OpCodeType *inData)
 
        // set first int argument to number
        inData->intArg2 = numBuffer;
+
+       // skip white space after the cycle count
+       while (strBuffer[runningStringIndex] != NULL_CHAR
+                                  && strBuffer[runningStringIndex] <= SPACE)
+         {
+          // increment the index
+          runningStringIndex++;
+         }
+
+       // check for optional target cylinder, used by the disk model
+       if (strBuffer[runningStringIndex] == COMMA)
+         {
+          // get number argument for cylinder
+             // function: getNumberArg
+          runningStringIndex = getNumberArg(&numBuffer,
+                                             strBuffer, runningStringIndex); 
+
+          // check for failed number access
+          if (numBuffer <= BAD_ARG_VAL)
+            {
+             // set failiure flag
+             arg3FailiureFlag = true;
+            }
+
+          // set second int argument to cylinder
+          inData->intArg3 = numBuffer;
+         }
       }
 
     // check for memory base and offset
@@ -628,7 +655,7 @@ Device Input/Keyboard: none
 Device Output/Monitor: none
 Dependencies: isDigit
 */
-int getNumberArg(int *number, const char *inputStr, int index)
+int getNumberArg(long long *number, const char *inputStr, int index)
    {
     // initialize function/variables
     bool foundDigit = false;
@@ -13,8 +13,8 @@ typedef struct OpCodeStruct
     char strArg1[STD_STR_LEN];
 
     int pid;
-    int intArg2;
-    int intArg3;
+    long long intArg2;
+    long long intArg3;
 
     double opEndTime;
 
@@ -99,7 +99,7 @@ Device Input/Keyboard: none
 Device Output/Monitor: none
 Dependencies: isDigit
 */
-int getNumberArg(int *number, const char *inputStr, int index);
+int getNumberArg(long long *number, const char *inputStr, int index);
 
 /*
 Name: getMetaData
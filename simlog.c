@@ -0,0 +1,604 @@
+#include "simlog.h"
+
+// fills a trace file header from the configuration
+void fillTraceHeader(traceHeaderType *headerPtr, ConfigDataType *cfgPtr)
+   {
+    // initialize function/variables
+    int index;
+
+    // tag the file, TRACE_MAGIC is not null terminated in the header
+    for (index = 0; index < TRACE_MAGIC_LEN; index++)
+      {
+       headerPtr->magic[index] = TRACE_MAGIC[index];
+      }
+
+    headerPtr->version = TRACE_VERSION;
+
+    headerPtr->recordSize = sizeof(traceFileRecordType);
+
+    // copy the configuration shown in the log header
+    copyString(headerPtr->metaDataFileName, cfgPtr->metaDataFileName);
+
+    headerPtr->cpuSchedCode = cfgPtr->cpuSchedCode;
+
+    headerPtr->quantumCycles = cfgPtr->quantumCycles;
+
+    headerPtr->memAvailable = cfgPtr->memAvailable;
+
+    headerPtr->procCycleRate = cfgPtr->procCycleRate;
+
+    headerPtr->ioCycleRate = cfgPtr->ioCycleRate;
+   }
+
+// formats a logged event into trace viewer events, state changes end the
+// old state slice and begin the new one, device operations are async spans
+// and ready queue changes update a counter, other events produce nothing
+void formatChromeRecord(const traceRecordType *recordPtr, char *outString,
+                                                   chromeStateType *statePtr)
+   {
+    // initialize function/variables
+    char stateName[STD_STR_LEN],
+         deviceName[STD_STR_LEN];
+    const char *inOut = recordPtr->isOutput ? "output" : "input";
+    long long timeNSec = recordPtr->timeNSec;
+    int readyCount = statePtr->readyCount;
+    bool deviceEvent = false, deviceStart = false;
+
+    *outString = NULL_CHAR;
+
+    // device events name their device
+    if (recordPtr->device < DEVICE_COUNT)
+      {
+       deviceCodeToString(recordPtr->device, deviceName);
+      }
+
+    switch (recordPtr->kind)
+      {
+       // end the old state slice and begin the new one on the process row,
+       // a preempted process is readied without a log line
+       case TRACE_OS_STATE:
+       case TRACE_OS_PREEMPT:
+          if (recordPtr->detail != NEW_STATE)
+            {
+             stateToString(recordPtr->detail, stateName);
+
+             outString += sprintf(outString,
+                                  ",\n{\"name\":\"%s\",\"ph\":\"E\",\"pid\":%d,"
+                                             "\"tid\":%d,\"ts\":%lld.%03lld}",
+                                                  stateName, CHROME_PROCESS_PID,
+                                                     recordPtr->processId + 1,
+                                             timeNSec / 1000, timeNSec % 1000);
+            }
+
+          // name the process row when it first arrives
+          else
+            {
+             outString += sprintf(outString,
+                              ",\n{\"name\":\"thread_name\",\"ph\":\"M\","
+                                                     "\"pid\":%d,\"tid\":%d,"
+                                        "\"args\":{\"name\":\"Process %d\"}}",
+                                 CHROME_PROCESS_PID, recordPtr->processId + 1,
+                                                         recordPtr->processId);
+            }
+
+          if (recordPtr->code != EXIT_STATE)
+            {
+             stateToString(recordPtr->code, stateName);
+
+             outString += sprintf(outString,
+                                  ",\n{\"name\":\"%s\",\"ph\":\"B\",\"pid\":%d,"
+                                             "\"tid\":%d,\"ts\":%lld.%03lld}",
+                                                  stateName, CHROME_PROCESS_PID,
+                                                     recordPtr->processId + 1,
+                                             timeNSec / 1000, timeNSec % 1000);
+            }
+
+          // track the ready queue length
+          if (recordPtr->detail == READY_STATE)
+            {
+             readyCount--;
+            }
+
+          if (recordPtr->code == READY_STATE)
+            {
+             readyCount++;
+            }
+          break;
+
+       // an interrupt ends the device operation of the interrupting process
+       case TRACE_OS_EVENT:
+          deviceEvent = recordPtr->code == CPU_INTERRUPT;
+          break;
+
+       // device operations start and, without preemption, end here
+       case TRACE_PROCESS_OP:
+          deviceEvent = recordPtr->detail == TRACE_OP_DEV;
+          deviceStart = recordPtr->code == COMMAND_START;
+          break;
+
+       // cpu idle periods show as slices on the simulator row
+       case TRACE_CPU_IDLE:
+       case TRACE_IDLE_END:
+          outString += sprintf(outString,
+                           ",\n{\"name\":\"CPU idle\",\"ph\":\"%s\",\"pid\":%d,"
+                                              "\"tid\":0,\"ts\":%lld.%03lld}",
+                                recordPtr->kind == TRACE_CPU_IDLE ? "B" : "E",
+                         CHROME_PROCESS_PID, timeNSec / 1000, timeNSec % 1000);
+          break;
+      }
+
+    // begin or end the async span of a device operation, one per process
+    if (deviceEvent && recordPtr->device < DEVICE_COUNT)
+      {
+       outString += sprintf(outString,
+                ",\n{\"name\":\"%s %s\",\"cat\":\"device\",\"ph\":\"%s\","
+                          "\"id\":%d,\"pid\":%d,\"tid\":%d,\"ts\":%lld.%03lld}",
+                                   deviceName, inOut, deviceStart ? "b" : "e",
+                                                     recordPtr->processId + 1,
+                                      CHROME_DEVICE_PID, recordPtr->device + 1,
+                                             timeNSec / 1000, timeNSec % 1000);
+      }
+
+    // update the ready queue counter when it changes
+    if (readyCount != statePtr->readyCount)
+      {
+       statePtr->readyCount = readyCount;
+
+       sprintf(outString,
+                    ",\n{\"name\":\"ready queue\",\"ph\":\"C\",\"pid\":%d,"
+                          "\"ts\":%lld.%03lld,\"args\":{\"processes\":%d}}",
+                         CHROME_PROCESS_PID, timeNSec / 1000, timeNSec % 1000,
+                                                                   readyCount);
+      }
+   }
+
+// formats a logged event into its output line, tracking whether the
+// last line was OS output for the spacing of process lines
+void formatTraceRecord(const traceRecordType *recordPtr, char *outString,
+                                                           bool *lastMsgOS)
+   {
+    // initialize function/variables
+    char currentState[STD_STR_LEN],
+         setState[STD_STR_LEN],
+         deviceName[STD_STR_LEN];
+    const char *inOut = recordPtr->isOutput ? "out" : "in";
+    const char *segFault = "";
+    long long timeNSec = recordPtr->timeNSec;
+
+    // device events name their device
+    if (recordPtr->device < DEVICE_COUNT)
+      {
+       deviceCodeToString(recordPtr->device, deviceName);
+      }
+
+    switch (recordPtr->kind)
+      {
+       // begin simulation line
+       case TRACE_BEGIN_SIM:
+          sprintf(outString, "Begin Simulation\n\n");
+          break;
+
+       // spacing line between groups of output
+       case TRACE_BLANK_LINE:
+          sprintf(outString, "\n");
+          break;
+
+       // generate state change string
+       case TRACE_OS_STATE:
+          stateToString(recordPtr->detail, currentState);
+
+          stateToString(recordPtr->code, setState);
+
+          sprintf(outString,
+                            TIME_FORMAT ", OS: Process %d set from %s to %s\n",
+                 TIME_SEC(timeNSec), TIME_USEC(timeNSec), recordPtr->processId,
+                                                       currentState, setState);
+
+          *lastMsgOS = true;
+          break;
+
+       // generate the rest of the OS strings
+       case TRACE_OS_EVENT:
+          switch (recordPtr->code)
+            {
+             // generate process selection string
+             case PROCESS_START:
+                sprintf(outString, TIME_FORMAT
+                          ", OS: Process %d selected with %lld ms remaining\n",
+                                       TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                                         recordPtr->processId, recordPtr->arg);
+                break;
+
+             // generate process termination string, noting a memory failiure
+             case PROCESS_END:
+                if (recordPtr->arg == ACCESS_FAILIURE
+                                        || recordPtr->arg == ALLOCATE_FAILIURE)
+                  {
+                   segFault = "Segmentation fault, ";
+                  }
+
+                sprintf(outString, TIME_FORMAT ", OS: %sProcess %d ended\n",
+                             TIME_SEC(timeNSec), TIME_USEC(timeNSec), segFault,
+                                                         recordPtr->processId);
+                break;
+
+             // generate simulation start string
+             case SIM_START:
+                sprintf(outString, TIME_FORMAT ", OS: Simulator Start\n",
+                                    TIME_SEC(timeNSec), TIME_USEC(timeNSec));
+                break;
+
+             // generate simulation end string
+             case SIM_END:
+                sprintf(outString, TIME_FORMAT ", OS: Simulator End\n",
+                                    TIME_SEC(timeNSec), TIME_USEC(timeNSec));
+                break;
+
+             // generate system stop string
+             case SYS_STOP:
+                sprintf(outString, TIME_FORMAT ", OS: System Stop\n",
+                                    TIME_SEC(timeNSec), TIME_USEC(timeNSec));
+                break;
+
+             // generate process interrupt string
+             case CPU_INTERRUPT:
+                sprintf(outString, TIME_FORMAT
+                       ", OS: Interrupted by Process %d, %s %sput operation\n",
+                                       TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                                      recordPtr->processId, deviceName, inOut);
+                break;
+
+             // generate process blocked string
+             case BLOCKED_IO:
+                sprintf(outString,
+                   TIME_FORMAT ", OS: Process %d blocked for %sput operation\n",
+                                       TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                                                  recordPtr->processId, inOut);
+                break;
+
+             // generate quantum cycle reached string
+             case CPU_QUANTUM:
+                sprintf(outString, TIME_FORMAT
+                      ", OS: Process %d quantum time out, cpu process"
+                                                        " operation end\n",
+                                       TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                                                         recordPtr->processId);
+                break;
+            }
+
+          *lastMsgOS = true;
+          break;
+
+       // generate op code strings, spaced from any OS output before them
+       case TRACE_PROCESS_OP:
+          sprintf(outString, "%s" TIME_FORMAT ", Process: %d, ",
+                                                         *lastMsgOS ? "\n" : "",
+                 TIME_SEC(timeNSec), TIME_USEC(timeNSec), recordPtr->processId);
+
+          // move to the end of the timestamp
+          while (*outString != NULL_CHAR)
+            {
+             outString++;
+            }
+
+          switch (recordPtr->detail)
+            {
+             // generate cpu start and end strings
+             case TRACE_OP_CPU:
+                sprintf(outString, "cpu process operation %s\n",
+                           recordPtr->code == COMMAND_START ? "start" : "end");
+                break;
+
+             // generate device start and end strings, preemptive scheduling
+             // leaves a line after the start
+             case TRACE_OP_DEV:
+                sprintf(outString, "%s %sput operation %s\n%s", deviceName,
+                     inOut, recordPtr->code == COMMAND_START ? "start" : "end",
+                    recordPtr->code == COMMAND_START && recordPtr->isPreemptive
+                                                                  ? "\n" : "");
+                break;
+
+             // generate the memory request and result strings
+             default:
+                switch (recordPtr->code)
+                  {
+                   case COMMAND_START:
+                      sprintf(outString, "mem %s request (%lld, %lld)\n",
+                            recordPtr->detail == TRACE_OP_ALLOCATE ? "allocate"
+                                 : "access", recordPtr->arg, recordPtr->value);
+                      break;
+
+                   case ALLOCATE_SUCCESS:
+                      sprintf(outString, "successful mem allocate request\n");
+                      break;
+
+                   case ALLOCATE_FAILIURE:
+                      sprintf(outString, "failed mem allocate request\n");
+                      break;
+
+                   case ACCESS_SUCCESS:
+                      sprintf(outString, "successful mem access request\n");
+                      break;
+
+                   case ACCESS_FAILIURE:
+                      sprintf(outString, "failed mem access request\n");
+                      break;
+                  }
+                break;
+            }
+
+          *lastMsgOS = false;
+          break;
+
+       // generate idle strings
+       case TRACE_CPU_IDLE:
+          sprintf(outString,
+                  TIME_FORMAT ", OS: CPU idle, all active processes blocked\n",
+                                      TIME_SEC(timeNSec), TIME_USEC(timeNSec));
+          break;
+
+       case TRACE_IDLE_END:
+          sprintf(outString, TIME_FORMAT ", OS: CPU interrupt, end idle\n",
+                                    TIME_SEC(timeNSec), TIME_USEC(timeNSec));
+          break;
+
+       // generate the end of simulation summaries
+       case TRACE_IDLE_TIME:
+          sprintf(outString,
+                   TIME_FORMAT ", OS: CPU idle time " DURATION_FORMAT " sec\n",
+                                       TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                      TIME_SEC(recordPtr->value), TIME_USEC(recordPtr->value));
+          break;
+
+       case TRACE_DEVICE_QUEUE:
+          sprintf(outString, TIME_FORMAT ", OS: %s queue wait " DURATION_FORMAT
+                                            " sec, %lld operations delayed\n",
+                           TIME_SEC(timeNSec), TIME_USEC(timeNSec), deviceName,
+                      TIME_SEC(recordPtr->value), TIME_USEC(recordPtr->value),
+                                                               recordPtr->arg);
+          break;
+
+       case TRACE_DISK_TRAVEL:
+          sprintf(outString, TIME_FORMAT ", OS: hard drive head travel"
+                                       " %lld cylinders, %lld requests\n",
+                                       TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                                             recordPtr->value, recordPtr->arg);
+          break;
+
+       // generate buddy placement strings, spaced like the op code strings
+       case TRACE_MEM_PLACED:
+          sprintf(outString, "%s" TIME_FORMAT
+                                          ", Process: %d, mem placed at %lld, "
+                                            "%lld KB internal fragmentation\n",
+               *lastMsgOS ? "\n" : "", TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                       recordPtr->processId, recordPtr->arg, recordPtr->value);
+
+          *lastMsgOS = false;
+          break;
+
+       case TRACE_MEM_FRAGMENTATION:
+          sprintf(outString, TIME_FORMAT
+              ", OS: buddy internal fragmentation %lld KB, %lld allocations\n",
+                                       TIME_SEC(timeNSec), TIME_USEC(timeNSec),
+                                             recordPtr->value, recordPtr->arg);
+          break;
+
+       // preemption and unknown records produce no output
+       default:
+          *outString = NULL_CHAR;
+          break;
+      }
+   }
+
+// joins the high and low 32 bits of a trace file value
+long long joinTraceValue(int high, unsigned int low)
+   {
+    return (long long)high * 0x100000000LL + (long long)low;
+   }
+
+// reads the next record of a binary trace file, and its continuation
+// when one follows, returns false at the end of the file
+bool readTraceRecord(FILE *traceFile, traceRecordType *recordPtr,
+                                                       long long *lastUSecPtr)
+   {
+    // initialize function/variables
+    traceFileRecordType fileRecord;
+    traceWideType wideRecord = { 0 };
+
+    if (fread(&fileRecord, sizeof(traceFileRecordType), 1, traceFile) != 1)
+      {
+       return false;
+      }
+
+    // sign extend the packed values unless their high bits follow
+    if (fileRecord.isWide)
+      {
+       if (fread(&wideRecord, sizeof(traceWideType), 1, traceFile) != 1)
+         {
+          return false;
+         }
+      }
+    else
+      {
+       wideRecord.timeDelta = fileRecord.timeDelta & TRACE_SIGN_BIT ? -1 : 0;
+       wideRecord.processId = fileRecord.processId;
+       wideRecord.arg = fileRecord.arg & TRACE_SIGN_BIT ? -1 : 0;
+       wideRecord.value = fileRecord.value & TRACE_SIGN_BIT ? -1 : 0;
+      }
+
+    // times are kept as the microseconds since the previous record
+    *lastUSecPtr += joinTraceValue(wideRecord.timeDelta,
+                                                        fileRecord.timeDelta);
+
+    recordPtr->timeNSec = *lastUSecPtr * NSEC_PER_USEC;
+    recordPtr->value = joinTraceValue(wideRecord.value, fileRecord.value);
+    recordPtr->arg = joinTraceValue(wideRecord.arg, fileRecord.arg);
+    recordPtr->processId = wideRecord.processId;
+    recordPtr->code = fileRecord.code;
+    recordPtr->kind = fileRecord.kind;
+    recordPtr->detail = fileRecord.detail;
+    recordPtr->device = fileRecord.device;
+    recordPtr->isOutput = fileRecord.isOutput;
+    recordPtr->isPreemptive = fileRecord.isPreemptive;
+
+    return true;
+   }
+
+// splits a value into its high and low 32 bits, returns true when the
+// high bits are needed to restore it
+bool splitTraceValue(long long value, int *highPtr, unsigned int *lowPtr)
+   {
+    *highPtr = (int)(value >> 32);
+    *lowPtr = (unsigned int)(value & 0xFFFFFFFFLL);
+
+    return value < TRACE_PACKED_MIN || value > TRACE_PACKED_MAX;
+   }
+
+// converts a process state code to its display name
+void stateToString(int stateCode, char *outString)
+   {
+    // Define array with five items, and short (10) lengths
+    char stateStrings[IGNORE_STATE][10] = {"NEW", "READY", "RUNNING",
+                                                       "BLOCKED", "EXIT"};
+
+    copyString(outString, stateStrings[stateCode]);
+   }
+
+// checks a trace file header was written by this version of the simulator
+bool verifyTraceHeader(const traceHeaderType *headerPtr)
+   {
+    // initialize function/variables
+    int index;
+
+    // check the file tag
+    for (index = 0; index < TRACE_MAGIC_LEN; index++)
+      {
+       if (headerPtr->magic[index] != TRACE_MAGIC[index])
+         {
+          return false;
+         }
+      }
+
+    // check the records can be read as written
+    return headerPtr->version == TRACE_VERSION
+               && headerPtr->recordSize == sizeof(traceFileRecordType);
+   }
+
+// closes the trace viewer event array
+void writeChromeFooter(FILE *logFile)
+   {
+    fprintf(logFile, "\n]\n");
+   }
+
+// opens the trace viewer event array and names its rows
+void writeChromeHeader(FILE *logFile, chromeStateType *statePtr)
+   {
+    // initialize function/variables
+    char deviceName[STD_STR_LEN];
+    int deviceCode;
+
+    fprintf(logFile, "[\n");
+
+    fprintf(logFile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                                        "\"args\":{\"name\":\"Processes\"}},\n",
+                                                           CHROME_PROCESS_PID);
+
+    // the OS row sits above the process rows, which are offset by one
+    fprintf(logFile,
+                 "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,"
+                    "\"args\":{\"name\":\"OS\"}},\n", CHROME_PROCESS_PID);
+
+    fprintf(logFile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                     "\"args\":{\"name\":\"Devices\"}}", CHROME_DEVICE_PID);
+
+    // name a row for each device
+    for (deviceCode = 0; deviceCode < DEVICE_COUNT; deviceCode++)
+      {
+       deviceCodeToString(deviceCode, deviceName);
+
+       fprintf(logFile,
+              ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+                                              "\"args\":{\"name\":\"%s\"}}",
+                               CHROME_DEVICE_PID, deviceCode + 1, deviceName);
+      }
+
+    // start with an empty ready queue
+    statePtr->readyCount = 0;
+   }
+
+// writes the configuration header at the top of the log file
+void writeLogHeader(FILE *logFile, const traceHeaderType *headerPtr,
+                                                      char *displayString)
+   {
+    // print all relevant configuration file data
+    fprintf(logFile,
+               "==================================================\n");
+
+    fprintf(logFile, "File Name                       : %s\n",
+                                                headerPtr->metaDataFileName);
+
+    configCodeToString(headerPtr->cpuSchedCode, displayString);
+
+    fprintf(logFile, "CPU Scheduling                  : %s\n",
+                                                         displayString);
+
+    fprintf(logFile, "Quantum Cycles                  : %d\n",
+                                                   headerPtr->quantumCycles);
+
+    fprintf(logFile, "Memory Available (KB)           : %lld\n",
+                                                   headerPtr->memAvailable);
+
+    fprintf(logFile, "Processor Cycle Rate (ms/cycle) : %d\n",
+                                                   headerPtr->procCycleRate);
+
+    fprintf(logFile, "I/O Cycle Rate (ms/cycle)       : %d\n",
+                                                   headerPtr->ioCycleRate);
+
+    fprintf(logFile, "================\n");
+   }
+
+// writes a record to a binary trace file, packed into 16 bytes with a
+// 16 byte continuation when a value or process id does not fit
+void writeTraceRecord(FILE *traceFile, const traceRecordType *recordPtr,
+                                                       long long *lastUSecPtr)
+   {
+    // initialize function/variables
+    traceFileRecordType fileRecord = { 0 };
+    traceWideType wideRecord;
+    long long timeUSec = recordPtr->timeNSec / NSEC_PER_USEC;
+    bool isWide;
+
+    // store times as the microseconds since the previous record
+    isWide = splitTraceValue(timeUSec - *lastUSecPtr,
+                                 &wideRecord.timeDelta, &fileRecord.timeDelta);
+
+    *lastUSecPtr = timeUSec;
+
+    isWide = splitTraceValue(recordPtr->arg, &wideRecord.arg,
+                                                    &fileRecord.arg) || isWide;
+
+    isWide = splitTraceValue(recordPtr->value, &wideRecord.value,
+                                                  &fileRecord.value) || isWide;
+
+    // the full process id is kept in the continuation
+    wideRecord.processId = recordPtr->processId;
+    fileRecord.processId = recordPtr->processId & TRACE_PACKED_PID_MAX;
+
+    isWide = isWide || recordPtr->processId < 0
+                             || recordPtr->processId > TRACE_PACKED_PID_MAX;
+
+    fileRecord.code = recordPtr->code;
+    fileRecord.kind = recordPtr->kind;
+    fileRecord.detail = recordPtr->detail;
+    fileRecord.device = recordPtr->device;
+    fileRecord.isOutput = recordPtr->isOutput;
+    fileRecord.isPreemptive = recordPtr->isPreemptive;
+    fileRecord.isWide = isWide;
+
+    fwrite(&fileRecord, sizeof(traceFileRecordType), 1, traceFile);
+
+    if (isWide)
+      {
+       fwrite(&wideRecord, sizeof(traceWideType), 1, traceFile);
+      }
+   }
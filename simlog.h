@@ -0,0 +1,213 @@
+#ifndef SIMLOG_H
+#define SIMLOG_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "configops.h"
+#include "datatypes.h"
+#include "simtimer.h"
+
+// tag at the start of every binary trace file
+#define TRACE_MAGIC "SIMTRACE"
+
+#define TRACE_MAGIC_LEN 8
+
+// changes whenever the record layout changes
+#define TRACE_VERSION 3
+
+// range of a value packed into 32 bits of a trace file record, and the
+// largest process id the packed id field holds
+#define TRACE_PACKED_MIN ( -2147483647LL - 1 )
+
+#define TRACE_PACKED_MAX 2147483647LL
+
+#define TRACE_PACKED_PID_MAX 8191
+
+// sign bit of the low 32 bits of a packed value
+#define TRACE_SIGN_BIT 0x80000000U
+
+// room for the trace viewer events of one record
+#define CHROME_EVENT_LEN 512
+
+// trace viewer process ids for the process and device timelines
+#define CHROME_PROCESS_PID 1
+
+#define CHROME_DEVICE_PID 2
+
+// enum struct for OS related operations/identifiers
+typedef enum { PROCESS_START  = -1,
+               PROCESS_END    = -2,
+               COMMAND_START  = -3,
+               COMMAND_END    = -4,
+               BLOCKED_IO     = -5,
+               SIM_START      = -6,
+               SIM_END        = -7,
+               SYS_STOP       = -8,
+               IGNORE_OSCODE  = -9,
+               CPU_INTERRUPT  = -10,
+               CPU_QUANTUM    = -11,
+               CPU_PREEMPT    = -12 } OsCodes;
+
+// enum struct for Memory related operations/identifiers
+typedef enum { INITIALIZE,
+               ALLOCATE,
+               ALLOCATE_SUCCESS,
+               ALLOCATE_FAILIURE,
+               ACCESS,
+               ACCESS_SUCCESS,
+               ACCESS_FAILIURE,
+               DEALLOCATE,
+               DEINITIALIZE,
+               IGNORE_MEM_CODE } MemCodes;
+
+// kinds of logged event, one per kind of output line
+typedef enum { TRACE_BEGIN_SIM,
+               TRACE_BLANK_LINE,
+               TRACE_OS_STATE,
+               TRACE_OS_EVENT,
+               TRACE_PROCESS_OP,
+               TRACE_CPU_IDLE,
+               TRACE_IDLE_END,
+               TRACE_IDLE_TIME,
+               TRACE_DEVICE_QUEUE,
+               TRACE_DISK_TRAVEL,
+               TRACE_OS_PREEMPT,
+               TRACE_MEM_PLACED,
+               TRACE_MEM_FRAGMENTATION } TraceKinds;
+
+// op codes an op record can describe
+typedef enum { TRACE_OP_CPU,
+               TRACE_OP_DEV,
+               TRACE_OP_ALLOCATE,
+               TRACE_OP_ACCESS } TraceOpKinds;
+
+// fixed size record of one logged event, the fields used depend on
+// the kind of event
+typedef struct traceRecordStruct
+   {
+    // simulation time of the event
+    long long timeNSec;
+
+    // second op argument, total reported by a summary, or internal
+    // fragmentation of a placement
+    long long value;
+
+    // first op argument, run time, count or base reported with the event
+    long long arg;
+
+    // process the event belongs to
+    int processId;
+
+    // OsCodes, state set, or command/MemCodes result of an op
+    short code;
+
+    // TraceKinds of the event
+    unsigned char kind;
+
+    // state set from, or TraceOpKinds of an op
+    unsigned char detail;
+
+    // DeviceCodes of a device event
+    unsigned char device;
+
+    // device operation is output rather than input
+    unsigned char isOutput;
+
+    // event logged under preemptive scheduling
+    unsigned char isPreemptive;
+
+   } traceRecordType;
+
+// 16 byte record of one event in a binary trace file, times are
+// microseconds since the previous record, a time step, argument or
+// process id too wide for its field sets isWide and its high bits
+// follow in a traceWideType record
+typedef struct traceFileRecordStruct
+   {
+    // time since the previous record, low 32 bits
+    unsigned int timeDelta;
+
+    // codes of the traceRecordType fields of the same names
+    unsigned int processId : 13;
+    unsigned int kind : 4;
+    signed int code : 5;
+    unsigned int detail : 3;
+    unsigned int device : 4;
+    unsigned int isOutput : 1;
+    unsigned int isPreemptive : 1;
+
+    // a traceWideType record follows this one
+    unsigned int isWide : 1;
+
+    // low 32 bits of the record arguments
+    unsigned int arg;
+    unsigned int value;
+
+   } traceFileRecordType;
+
+// 16 byte continuation of a trace file record, holds the high 32 bits
+// of its values and the full process id
+typedef struct traceWideStruct
+   {
+    int timeDelta;
+    int processId;
+    int arg;
+    int value;
+
+   } traceWideType;
+
+// start of a binary trace file, holds what the log file header shows
+typedef struct traceHeaderStruct
+   {
+    char magic[TRACE_MAGIC_LEN];
+    int version;
+    int recordSize;
+    char metaDataFileName[MAX_STR_LEN];
+    int cpuSchedCode;
+    int quantumCycles;
+    long long memAvailable;
+    int procCycleRate;
+    int ioCycleRate;
+
+   } traceHeaderType;
+
+// running state of a trace viewer (Chrome Trace Event JSON) output
+typedef struct chromeStateStruct
+   {
+    // processes currently in the ready state
+    int readyCount;
+
+   } chromeStateType;
+
+// function prototypes
+
+void fillTraceHeader(traceHeaderType *headerPtr, ConfigDataType *cfgPtr);
+
+void formatChromeRecord(const traceRecordType *recordPtr, char *outString,
+                                                   chromeStateType *statePtr);
+
+void formatTraceRecord(const traceRecordType *recordPtr, char *outString,
+                                                           bool *lastMsgOS);
+
+long long joinTraceValue(int high, unsigned int low);
+
+bool readTraceRecord(FILE *traceFile, traceRecordType *recordPtr,
+                                                       long long *lastUSecPtr);
+
+bool splitTraceValue(long long value, int *highPtr, unsigned int *lowPtr);
+
+void stateToString(int stateCode, char *outString);
+
+bool verifyTraceHeader(const traceHeaderType *headerPtr);
+
+void writeChromeFooter(FILE *logFile);
+
+void writeChromeHeader(FILE *logFile, chromeStateType *statePtr);
+
+void writeLogHeader(FILE *logFile, const traceHeaderType *headerPtr,
+                                                     char *displayString);
+
+void writeTraceRecord(FILE *traceFile, const traceRecordType *recordPtr,
+                                                       long long *lastUSecPtr);
+
+#endif // SIMLOG_H
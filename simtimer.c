@@ -27,201 +27,188 @@
 
 // Constants  /////////////////////////////////////////////////////////////////
 
-const char RADIX_POINT = '.';
+const long long NSEC_PER_SEC = 1000000000LL;
 
-void runTimer( int milliSeconds )
+/* Each simulation owns its timer, so several simulations can run
+   side by side in one process; the wait settings are fixed when the
+   timer is created and only the owning simulation moves the clock
+*/
+SimTimerType *createTimer( int clockCode, int waitCode, int spinUSec, 
+                                                            int scaleFactor )
    {
-    struct timeval startTime, endTime;
-    int startSec, startUSec, endSec, endUSec;
-    int uSecDiff, mSecDiff, secDiff, timeDiff;
-    
-
-    gettimeofday( &startTime, NULL );
- 
-    startSec = startTime.tv_sec;
-    startUSec = startTime.tv_usec;
-
-    timeDiff = 0;
+    SimTimerType *timer = (SimTimerType *) malloc( sizeof( SimTimerType ) );
 
-    while( timeDiff < milliSeconds )
-       {
-        gettimeofday( &endTime, NULL );
+    // the virtual clock only moves when runTimer is called, producing
+    // the wall clock timeline without spending real time waiting
+    timer->clockCode = clockCode;
 
-        endSec = endTime.tv_sec;
-        endUSec = endTime.tv_usec;
-        uSecDiff = endUSec - startUSec;
+    // sleep and hybrid waits leave the processor free for other work;
+    // hybrid sleeps to just short of the deadline and spins the rest
+    timer->waitCode = waitCode;
+    timer->spinUSec = spinUSec;
 
-        if( uSecDiff < 0 )
-           {
-            uSecDiff = uSecDiff + 1000000;
+    // a scaled wall clock runs every wait faster by the scale factor
+    // and multiplies elapsed time back up, the virtual clock is unscaled
+    timer->scaleFactor = scaleFactor;
 
-            endSec = endSec - 1;
-           }
+    timer->running = false;
+    timer->startNSec = 0;
+    timer->virtualNSec = 0;
 
-        mSecDiff = uSecDiff / 1000;
-        secDiff = ( endSec - startSec ) * 1000;
-        timeDiff = secDiff + mSecDiff;
-       }
+    return timer;
    }
 
-double accessTimer( int controlCode, char *timeStr )
+SimTimerType *clearTimer( SimTimerType *timer )
    {
-    static bool running = false;
-    static int startSec = 0, endSec = 0, startUSec = 0, endUSec = 0;
-    static int lapSec = 0, lapUSec = 0;
-    struct timeval startData, lapData, endData;
-    double fpTime = 0.0;
-
-    switch( controlCode )
-       {
-        case ZERO_TIMER:
-           gettimeofday( &startData, NULL );
-           running = true;
+    free( timer );
 
-           startSec = startData.tv_sec;
-           startUSec = startData.tv_usec;
-
-           fpTime = 0.000000000;
-           lapSec = 0.000000000;
-           lapUSec = 0.000000000;
-
-           timeToString( lapSec, lapUSec, timeStr ); 
-           break;
-           
-        case LAP_TIMER:
-           if( running == true )
-              {
-               gettimeofday( &lapData, NULL );
+    return NULL;
+   }
 
-               lapSec = lapData.tv_sec;
-               lapUSec = lapData.tv_usec;
+static long long readMonotonic( void )
+   {
+    struct timespec timeData;
 
-               fpTime = processTime( startSec, lapSec, 
-                                                 startUSec, lapUSec, timeStr );
-              }
+    clock_gettime( CLOCK_MONOTONIC, &timeData );
 
-           else
-              {
-               fpTime = 0.000000000;
-              }
-           break;
-
-        case STOP_TIMER:
-           if( running == true )
-              {
-               gettimeofday( &endData, NULL );
-               running = false;
+    return (long long) timeData.tv_sec * NSEC_PER_SEC + timeData.tv_nsec;
+   }
 
-               endSec = endData.tv_sec;
-               endUSec = endData.tv_usec;
+static long long readClock( SimTimerType *timer )
+   {
+    if( timer->clockCode == VIRTUAL_CLOCK )
+       {
+        return timer->virtualNSec;
+       }
 
-               fpTime = processTime( startSec, endSec, 
-                                                 startUSec, endUSec, timeStr );
-              }
+    return readMonotonic();
+   }
 
-           // assume timer not running
-           else
-              {
-               fpTime = 0.000000000;
-              }
-           break;
+static long long elapsedSince( SimTimerType *timer, long long startNSec )
+   {
+    if( timer->clockCode == VIRTUAL_CLOCK )
+       {
+        return readClock( timer ) - startNSec;
        }
 
-    return fpTime;
+    return ( readClock( timer ) - startNSec ) * timer->scaleFactor;
    }
 
-double processTime( double startSec, double endSec, 
-                           double startUSec, double endUSec, char *timeStr )
+static void sleepUntil( long long wakeNSec )
    {
-    double secDiff = endSec - startSec;
-    double uSecDiff = endUSec - startUSec;
-    double fpTime;
+    struct timespec wakeTime;
 
-    fpTime = (double) secDiff + (double) uSecDiff / 1000000;
+    wakeTime.tv_sec = wakeNSec / NSEC_PER_SEC;
+    wakeTime.tv_nsec = wakeNSec % NSEC_PER_SEC;
 
-    if( uSecDiff < 0 )
+    // restart the sleep if a signal cuts it short
+    while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, 
+                                              &wakeTime, NULL ) == EINTR )
        {
-        uSecDiff = uSecDiff + 1000000;
-        secDiff = secDiff - 1;
        }
-
-    timeToString( secDiff, uSecDiff, timeStr );
-
-    return fpTime;
    }
 
-
-/* This is a bit of a drawn-out function, but it is written
-   to force the time result to always be in the form x.xxxxxxx
-   when printed as a string; this will not always be the case
-   if the time is presented as a floating point number
-*/
-void timeToString( int secTime, int uSecTime, char *timeStr )
+static void waitUntil( SimTimerType *timer, long long deadline )
    {
-    int low, high, index = 0;
-    char temp;
+    if( timer->waitCode == SLEEP_WAIT )
+       {
+        sleepUntil( deadline );
+       }
 
-    while( uSecTime > 0 )
+    else if( timer->waitCode == HYBRID_WAIT )
        {
-        timeStr[ index ] = (char) ( uSecTime % 10 + '0' );
-        uSecTime /= 10;
+        sleepUntil( deadline - (long long) timer->spinUSec * NSEC_PER_USEC );
+       }
 
-        index++;
-        
+    // spin out whatever remains of the wait
+    while( readMonotonic() < deadline )
+       {
        }
+   }
 
-    while( index < 6 )
+void runTimer( SimTimerType *timer, int milliSeconds )
+   {
+    if( timer->clockCode == VIRTUAL_CLOCK )
        {
-        timeStr[ index ] = '0';
+        timer->virtualNSec += (long long) milliSeconds * NSEC_PER_MSEC;
 
-        index++;
+        return;
        }
 
-    timeStr[ index ] = RADIX_POINT;
-
-    index++;
+    waitUntil( timer, readMonotonic() + (long long) milliSeconds
+                                        * NSEC_PER_MSEC / timer->scaleFactor );
+   }
 
-    if( secTime < 10 ) // single digit in display
+/* Runs the timer up to a simulation timestamp, to the nanosecond;
+   a timestamp already passed returns at once
+*/
+void runTimerUntil( SimTimerType *timer, long long simNSec )
+   {
+    if( timer->clockCode == VIRTUAL_CLOCK )
        {
-        timeStr[ index ] = (char) ( secTime % 10 + '0' );
-
-        index++;
+        if( timer->virtualNSec < timer->startNSec + simNSec )
+           {
+            timer->virtualNSec = timer->startNSec + simNSec;
+           }
 
-        timeStr[ index ] = SPACE;
+        return;
+       }
 
-        index++;
+    waitUntil( timer, timer->startNSec + simNSec / timer->scaleFactor );
+   }
 
-        secTime = 0;
-       }
-/*
-    if( secTime == 0 )
-       {
-        timeStr[ index ] = '0';
-    
-        index++;
-       }
+/* Timestamps are returned as whole nanoseconds since ZERO_TIMER;
+   conversion to text is left to the caller, see TIME_FORMAT
 */
-    while( secTime > 0 )
-       {
-        timeStr[ index ] = (char) ( secTime % 10 + '0' );
+long long accessTimer( SimTimerType *timer, int controlCode )
+   {
+    long long elapsedNSec = 0;
 
-        secTime /= 10;
+    switch( controlCode )
+       {
+        case ZERO_TIMER:
+           timer->virtualNSec = 0;
+           timer->startNSec = readClock( timer );
+           timer->running = true;
+           break;
+           
+        case LAP_TIMER:
+           if( timer->running == true )
+              {
+               elapsedNSec = elapsedSince( timer, timer->startNSec );
+              }
+           break;
 
-        index++;
+        case STOP_TIMER:
+           if( timer->running == true )
+              {
+               elapsedNSec = elapsedSince( timer, timer->startNSec );
+               timer->running = false;
+              }
+           break;
        }
 
-    timeStr[ index ] = NULL_CHAR;
+    return elapsedNSec;
+   }
 
-    low = 0; high = index - 1;
+/* Converts a simulation timestamp into the absolute CLOCK_MONOTONIC
+   time it falls due, for use with timed waits on the wall clock
+*/
+void timerDeadline( SimTimerType *timer, long long simNSec, 
+                                                  struct timespec *deadline )
+   {
+    long long realNSec = timer->startNSec + simNSec / timer->scaleFactor;
 
-    while( low < high )
-       {
-        temp = timeStr[ low ];
-        timeStr[ low ] = timeStr[ high ];
-        timeStr[ high ] = temp;
+    deadline->tv_sec = realNSec / NSEC_PER_SEC;
+    deadline->tv_nsec = realNSec % NSEC_PER_SEC;
+   }
 
-        low++; high--;
-       }
+/* Formats a timestamp in the form x.xxxxxx, with a leading space
+   for single digit seconds, to match the simulator output
+*/
+void timeToString( long long nanoSec, char *timeStr )
+   {
+    sprintf( timeStr, TIME_FORMAT, TIME_SEC( nanoSec ), TIME_USEC( nanoSec ) );
    }
 
 #endif // ifndef SIMTIMER_C
@@ -21,9 +21,10 @@
 
 // Header files ///////////////////////////////////////////////////////////////
 
-#include <sys/time.h>
-#include <string.h>
-#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
 #include <stdbool.h>
 #include "StandardConstants.h"
 
@@ -31,13 +32,50 @@
 
 enum TIMER_CTRL_CODES { ZERO_TIMER, LAP_TIMER, STOP_TIMER };
 
+enum TIMER_CLOCK_CODES { WALL_CLOCK, VIRTUAL_CLOCK };
+
+enum TIMER_WAIT_CODES { SPIN_WAIT, SLEEP_WAIT, HYBRID_WAIT };
+
+// nanoseconds per millisecond and microsecond for converting cycle 
+// and seek times to timestamps
+#define NSEC_PER_MSEC 1000000LL
+#define NSEC_PER_USEC 1000LL
+
+// timestamp output format, seconds and microseconds from nanoseconds
+#define TIME_FORMAT "%2lld.%06lld"
+
+// duration output format, unpadded for use within a line
+#define DURATION_FORMAT "%lld.%06lld"
+#define TIME_SEC( nanoSec ) ( ( nanoSec ) / 1000000000LL )
+#define TIME_USEC( nanoSec ) ( ( nanoSec ) % 1000000000LL / 1000LL )
+
+// Data Structures  ///////////////////////////////////////////////////////////
+
+typedef struct SimTimerStruct
+   {
+    int clockCode;
+    int waitCode;
+    int spinUSec;
+    int scaleFactor;
+
+    bool running;
+
+    long long startNSec;
+    long long virtualNSec;
+
+   } SimTimerType;
+
 // Function Prototyp  /////////////////////////////////////////////////////////
 
-void runTimer( int milliSeconds );
-double accessTimer( int controlCode, char *timeStr );
-double processTime( double startSec, double endSec, 
-                           double startUSec, double endUSec, char *timeStr );
-void timeToString( int secTime, int uSecTime, char *timeStr );
+SimTimerType *createTimer( int clockCode, int waitCode, int spinUSec, 
+                                                            int scaleFactor );
+SimTimerType *clearTimer( SimTimerType *timer );
+void runTimer( SimTimerType *timer, int milliSeconds );
+void runTimerUntil( SimTimerType *timer, long long simNSec );
+long long accessTimer( SimTimerType *timer, int controlCode );
+void timerDeadline( SimTimerType *timer, long long simNSec, 
+                                                  struct timespec *deadline );
+void timeToString( long long nanoSec, char *timeStr );
 
 #endif // ifndef SIMTIMER_H
 
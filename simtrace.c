@@ -0,0 +1,112 @@
+// header files
+#include "simlog.h"
+
+// renders a binary trace written with "Log To : Trace" into the text the
+// log file would have held, or into trace viewer events with -chrome, to
+// standard output or the named file
+int main(int argc, char **argv)
+   {
+    // initialize program
+
+       // initialize variables
+       FILE *traceFile, *outFile = stdout;
+       traceHeaderType header;
+       traceRecordType record;
+       chromeStateType chromeState;
+       char displayString[CHROME_EVENT_LEN];
+       bool lastMsgOS = false, chromeOutput = false;
+       long long lastUSec = 0;
+       int argIndex = 1;
+
+    // check for the trace viewer switch
+    if (argc > 1 && compareString(argv[1], "-chrome") == STR_EQ)
+      {
+       chromeOutput = true;
+
+       argIndex++;
+      }
+
+    // check for the trace file name, and optional output file name
+    if (argc - argIndex != 1 && argc - argIndex != 2)
+      {
+       printf("Usage: simtrace [-chrome] <trace file> [output file]\n");
+
+       return 1;
+      }
+
+    // open the trace, check the header was written by this simulator
+    traceFile = fopen(argv[argIndex], "rb");
+
+    if (traceFile == NULL)
+      {
+       printf("Trace Error: unable to open %s\n", argv[argIndex]);
+
+       return 1;
+      }
+
+    if (fread(&header, sizeof(traceHeaderType), 1, traceFile) != 1
+                                             || !verifyTraceHeader(&header))
+      {
+       printf("Trace Error: %s is not a simulator trace\n", argv[argIndex]);
+
+       fclose(traceFile);
+
+       return 1;
+      }
+
+    // open the output file when one is named
+    if (argc - argIndex == 2)
+      {
+       outFile = fopen(argv[argIndex + 1], "w");
+
+       if (outFile == NULL)
+         {
+          printf("Trace Error: unable to open %s\n", argv[argIndex + 1]);
+
+          fclose(traceFile);
+
+          return 1;
+         }
+      }
+
+    // print the header, then every record in order, then the footer
+    if (chromeOutput)
+      {
+       writeChromeHeader(outFile, &chromeState);
+
+       while (readTraceRecord(traceFile, &record, &lastUSec))
+         {
+          formatChromeRecord(&record, displayString, &chromeState);
+
+          fputs(displayString, outFile);
+         }
+
+       writeChromeFooter(outFile);
+      }
+    else
+      {
+       writeLogHeader(outFile, &header, displayString);
+
+       while (readTraceRecord(traceFile, &record, &lastUSec))
+         {
+          formatTraceRecord(&record, displayString, &lastMsgOS);
+
+          fputs(displayString, outFile);
+         }
+
+       // add simulation end output
+       fprintf(outFile, "\nEnd Simulation - Complete\n");
+
+       fprintf(outFile, "=========================\n");
+      }
+
+    // shut down program
+    fclose(traceFile);
+
+    if (outFile != stdout)
+      {
+       fclose(outFile);
+      }
+
+    return 0;
+   }
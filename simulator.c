@@ -1,70 +1,194 @@
 #include "simulator.h"
 
-// semaphore lock value
-static sem_t interruptLock;
-
-
 //////////////////////////////
 //    INTERRUPT MANAGER     //
 //////////////////////////////
 
-// adds a blocked process to the interrupt queue
-void addToQueue(int *interruptQueue, int processId)
+// adds a process to the interrupt queue, safe to call from any thread,
+// returns false if the ring is full
+bool addToQueue(InterruptQueueType *interruptQueue, int processId)
    {
-    int index = 0;
+    // initialize function/variables
+    interruptSlotType *slot;
+    long long position, sequence;
+
+    position = __atomic_load_n(&interruptQueue->tail, __ATOMIC_RELAXED);
+
+    // loop until a free slot is claimed
+    while (true)
+      {
+       slot = &interruptQueue->slots[position & (interruptQueue->capacity - 1)];
+
+       sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+
+       // slot is free for this position, try to claim it
+       if (sequence == position)
+         {
+          if (__atomic_compare_exchange_n(&interruptQueue->tail, &position, 
+                        position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+             break;
+            }
+         }
+
+       // slot still holds an interrupt from the previous lap, ring is full
+       else if (sequence < position)
+         {
+          return false;
+         }
+
+       // another producer claimed the position, catch up
+       else
+         {
+          position = __atomic_load_n(&interruptQueue->tail, __ATOMIC_RELAXED);
+         }
+      }
+
+    // fill the slot then publish it to the simulation
+    slot->processId = processId;
+
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+
+    // wake the simulation if it is waiting idle, the fence orders the 
+    // publish before the flag check, matching the fence in the wait
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&interruptQueue->idleWaiting, __ATOMIC_RELAXED))
+      {
+       pthread_mutex_lock(&interruptQueue->idleLock);
+
+       pthread_cond_signal(&interruptQueue->idleSignal);
+
+       pthread_mutex_unlock(&interruptQueue->idleLock);
+      }
+
+    return true;
+   }
 
-    while (interruptQueue[index] != EMPTY_QUEUE_VALUE)
+// frees the interrupt queue
+InterruptQueueType *clearInterruptQueue(InterruptQueueType *interruptQueue)
+   {
+    // check for a queue to free
+    if (interruptQueue != NULL)
       {
-       index++;
+       pthread_cond_destroy(&interruptQueue->idleSignal);
+
+       pthread_mutex_destroy(&interruptQueue->idleLock);
+
+       free(interruptQueue->slots);
+
+       free(interruptQueue);
       }
 
-    interruptQueue[index] = processId;
+    return NULL;
    }
 
-// function for running IO on a p_thread
+// function for an io worker p_thread, the pool of workers shares the
+// event queue and each delivers one completion at a time
 void *handleIO(void *args)
    {    
     // initialize functions and variables
-    processType *prcPtr = (processType *) args;
-    
-    // run the timer for specifed IO time
-    runTimer(prcPtr->ioCycleTime * prcPtr->opHeadPtr->intArg2);
+    eventQueueType *queue = (eventQueueType *) args;
+    struct timespec deadline;
+    eventType event;
+
+    pthread_mutex_lock(&queue->eventLock);
+
+    // loop until the simulation shuts the pool down
+    while (!queue->shutdown)
+      {
+       // wait for an io operation to be started
+       if (queue->eventCount == 0)
+         {
+          pthread_cond_wait(&queue->eventSignal, &queue->eventLock);
+         }
+
+       // take the earliest completion once it is due
+       else if (queue->heap[FIRST_INDEX].eventTime 
+                                    <= accessTimer(queue->timerPtr, LAP_TIMER))
+         {
+          event = popEvent(queue);
+
+          // hand any further due completion to another idle worker
+          if (queue->eventCount > 0)
+            {
+             pthread_cond_signal(&queue->eventSignal);
+            }
+
+          // raise the interrupt outside the event lock so the other 
+          // workers and the simulation can use the queue meanwhile
+          pthread_mutex_unlock(&queue->eventLock);
+
+          deliverEvent(queue, &event);
+
+          pthread_mutex_lock(&queue->eventLock);
+         }
+
+       // otherwise sleep until the earliest completion, or until an
+       // earlier one is added
+       else
+         {
+          timerDeadline(queue->timerPtr, queue->heap[FIRST_INDEX].eventTime, 
+                                                                     &deadline);
+
+          pthread_cond_timedwait(&queue->eventSignal, &queue->eventLock, 
+                                                                     &deadline);
+         }
+      }
+
+    pthread_mutex_unlock(&queue->eventLock);
 
-    // call the semaphore wait to queue access to critical section
-    sem_wait(&interruptLock);
-    
-    // call the interrupt manager to add an interrupt to the queue
-    interruptManager(prcPtr, prcPtr->interruptQueue, IGNORE_INTER_PARAM, ADD_TO_QUEUE);
-    
-    // call semaphore post to exit critical section
-    sem_post(&interruptLock);
-    
     // exit the p_thread when finished
-    pthread_exit(NULL);
+    return NULL;
    }
 
 // initializes the interrupt queue
-int *initializeQueue(int prcCount)
+InterruptQueueType *initializeQueue(int prcCount)
    {
     // initialize function/variables
-    int index, *queue;
-    
-    // allocate the queue based on the number of processes loaded
-    queue = (int *)malloc(prcCount * sizeof(int));
+    long long index;
+    InterruptQueueType *queue;
+
+    queue = (InterruptQueueType *)malloc(sizeof(InterruptQueueType));
+
+    // each process has at most one interrupt pending, round the ring 
+    // size up to a power of two so positions wrap with a mask
+    queue->capacity = 1;
+
+    while (queue->capacity < prcCount)
+      {
+       queue->capacity *= 2;
+      }
+
+    queue->slots = (interruptSlotType *)malloc(queue->capacity 
+                                                   * sizeof(interruptSlotType));
     
-    // loop through the interrupt queue
-    for (index = 0; index < prcCount; index++)
+    // loop through the ring
+    for (index = 0; index < queue->capacity; index++)
       {
-       // set each value to EMPTY_QUEUE_VALUE constant
-       queue[index] = EMPTY_QUEUE_VALUE;
+       // each slot starts free for its first lap position
+       queue->slots[index].sequence = index;
+
+       queue->slots[index].processId = EMPTY_QUEUE_VALUE;
       }
+
+    queue->head = 0;
+
+    queue->tail = 0;
+
+    queue->idleWaiting = false;
+
+    pthread_mutex_init(&queue->idleLock, NULL);
+
+    pthread_cond_init(&queue->idleSignal, NULL);
     
     // return the allocated queue
     return queue;
    }
 
 // interrupt manager for handling all interrupt actions
-int *interruptManager(processType *prcPtr, int *queue, int queueSize, int interCode)
+InterruptQueueType *interruptManager(processType *prcPtr,
+                       InterruptQueueType *queue, int queueSize, int interCode)
    {
     // decide which action to execute
     switch (interCode)
@@ -106,8 +230,8 @@ int *interruptManager(processType *prcPtr, int *queue, int queueSize, int interC
           // pop the first op command pointed to in the process node
           prcPtr->opHeadPtr =  clearOpCommand(prcPtr->opHeadPtr);
           
-          // remove the process from the queue and shift other indexes forward
-          popInterruptQueue(queue, queueSize);
+          // remove the process from the front of the queue
+          popInterruptQueue(queue);
 
           break;
       }
@@ -115,731 +239,2783 @@ int *interruptManager(processType *prcPtr, int *queue, int queueSize, int interC
     return NULL;
    }
 
-// removes a blocked process from the interrupt queue
-void popInterruptQueue(int *interruptQueue, int queueSize)
+// returns the process id of the oldest interrupt, or EMPTY_QUEUE_VALUE,
+// only the simulation may call this
+int peekInterruptQueue(InterruptQueueType *interruptQueue)
    {
     // initialize function/variables
-    int index = 0, nextIndex = index +1;
-    
-    // loop while the end of the array isn't reached
-    while (nextIndex < queueSize)
-      {
-       // set the next index's value to the current index
-       interruptQueue[index] = interruptQueue[nextIndex];
-
-       // set the next index's value to EMPTY constant
-       interruptQueue[nextIndex] = EMPTY_QUEUE_VALUE;
+    long long position = interruptQueue->head;
+    interruptSlotType *slot = &interruptQueue->slots[position 
+                                             & (interruptQueue->capacity - 1)];
 
-       // increment both indexes
-       index++;
-       nextIndex++;
+    // the slot holds an interrupt once its producer has published it
+    if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) == position + 1)
+      {
+       return slot->processId;
       }
+
+    return EMPTY_QUEUE_VALUE;
    }
 
+// removes the oldest interrupt from the queue, only the simulation may
+// call this after peekInterruptQueue has found an interrupt
+void popInterruptQueue(InterruptQueueType *interruptQueue)
+   {
+    // initialize function/variables
+    long long position = interruptQueue->head;
+    interruptSlotType *slot = &interruptQueue->slots[position 
+                                             & (interruptQueue->capacity - 1)];
+
+    // free the slot for the producers' next lap
+    __atomic_store_n(&slot->sequence, position + interruptQueue->capacity, 
+                                                              __ATOMIC_RELEASE);
 
-//////////////////////////////
-//    LOGFILE FUNCTIONS     //
-//////////////////////////////
+    interruptQueue->head = position + 1;
+   }
 
-// adds a node to the log file linked list
-logFileType *addLogFileNode(logFileType *ptr, char *command)
+// blocks the idle simulation until an interrupt has been raised
+void waitForInterrupt(InterruptQueueType *interruptQueue)
    {
-    // check if the parameter pointer is null
-    if (ptr == NULL)
-      {
-       // allocate memory for the node
-       ptr = (logFileType *)malloc(sizeof(logFileType));
-       
-       // copy the command parameter into the node
-       copyString(ptr->opCommand, command);
+    pthread_mutex_lock(&interruptQueue->idleLock);
 
-       // point the next node pointer to null
-       ptr->nextCommand = NULL;
-       
-       // return the newly allocated node
-       return ptr;
+    // announce the wait before checking the queue, producers check the
+    // flag after publishing, so one side always sees the other
+    __atomic_store_n(&interruptQueue->idleWaiting, true, __ATOMIC_RELAXED);
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    while (peekInterruptQueue(interruptQueue) == EMPTY_QUEUE_VALUE)
+      {
+       pthread_cond_wait(&interruptQueue->idleSignal,
+                                                    &interruptQueue->idleLock);
       }
-    
-    // point the next node pointer to recursive function call
-    ptr->nextCommand = addLogFileNode(ptr->nextCommand, command);
-    
-    // return the pointer parameter
-    return ptr;
+
+    __atomic_store_n(&interruptQueue->idleWaiting, false, __ATOMIC_RELAXED);
+
+    pthread_mutex_unlock(&interruptQueue->idleLock);
    }
 
-// clears the entire log file linked list
-logFileType *clearLogFileStruct(logFileType *logPtr)
+//////////////////////////////
+//      EVENT FUNCTIONS     //
+//////////////////////////////
+
+// adds an io completion event to the queue, waking the io thread if
+// the new event is now the earliest
+void addEvent(eventQueueType *queue, processType *prcPtr, diskType *diskPtr, 
+                                                           long long eventTime)
    {
     // initialize function/variables
-    logFileType *temp;
-    
-    // check if current pointer points to data
-    while (logPtr != NULL)
+    int index, parent;
+    eventType newEvent;
+
+    // assign relevant info from parameters, the sequence number keeps
+    // equal time events in the order they were added
+    newEvent.eventTime = eventTime;
+
+    newEvent.prcPtr = prcPtr;
+
+    newEvent.diskPtr = diskPtr;
+
+    pthread_mutex_lock(&queue->eventLock);
+
+    newEvent.sequence = queue->nextSequence++;
+
+    // grow the heap if it is full
+    if (queue->eventCount == queue->capacity)
       {
-       // point temp to the next node pointer
-       temp = logPtr;
-       
-       // point to temp to regain linked list head location
-       logPtr = logPtr->nextCommand;
+       queue->capacity = queue->capacity * 2 + 1;
 
-       // free the current node
-       free(temp);       
+       queue->heap = (eventType *)realloc(queue->heap, 
+                                         queue->capacity * sizeof(eventType));
       }
 
-    return NULL;
-   }
+    // sift the new event up from the bottom of the heap
+    index = queue->eventCount;
 
-// function for deciding to print or store output
-logFileType *displayCommand(logFileType *logPtr, char *toWrite, 
-                                                               int displayCode)
-   {
-    // check the display code type for moitor output
-    if (displayCode == LOGTO_MONITOR_CODE || displayCode == LOGTO_BOTH_CODE)
+    queue->eventCount++;
+
+    while (index > FIRST_INDEX)
       {
-       // print the output
-       printf("%s", toWrite);
+       parent = (index - 1) / 2;
+
+       if (!eventBefore(&newEvent, &queue->heap[parent]))
+         {
+          break;
+         }
+
+       queue->heap[index] = queue->heap[parent];
+
+       index = parent;
       }
-    
-    // check the display code for file output
-   if (displayCode == LOGTO_FILE_CODE || displayCode == LOGTO_BOTH_CODE)
+
+    queue->heap[index] = newEvent;
+
+    // wake an io worker so it can wait for an earlier deadline
+    if (index == FIRST_INDEX)
       {
-       // call function to add command to log file linked list
-       logPtr = addLogFileNode(logPtr, toWrite);
+       pthread_cond_signal(&queue->eventSignal);
       }
-    
-    // temporary stub return
-    return logPtr;
+
+    pthread_mutex_unlock(&queue->eventLock);
    }
 
-// function for generating OS related output
-logFileType *osStringEngine(processType *prcPtr, logFileType *logHeadPtr, 
-                            int displayCode, int osCode, int stateCode, int memCode, 
-                           char *displayString, bool isPreemptive, bool *lastMsgOS)
+// stops and joins the io workers, if any, and frees the event queue
+eventQueueType *clearEventQueue(eventQueueType *queue)
    {
     // initialize function/variables
-    char currentState[STD_STR_LEN], 
-         setState[STD_STR_LEN], 
-         outputSegment[MAX_STR_LEN],
-         totalTime[MIN_STR_LEN];
-    
-    // get current runtime of simulation
-    accessTimer(LAP_TIMER, totalTime);
-    
-    // generate timestamp and output type
-    sprintf(displayString, "%s, OS: ", totalTime);
-    
-    // check if the OS output is related to a state change
-    if (stateCode != IGNORE_STATE)
-      {
-       // get the current state of the process
-       switch (prcPtr->processState)
-         {
-          case NEW_STATE:
-            copyString(currentState, "NEW");
-            break;
+    int index;
 
-          case READY_STATE:
-             copyString(currentState, "READY");
-             break;
+    // wake every worker to see the shutdown
+    pthread_mutex_lock(&queue->eventLock);
 
-          case RUNNING_STATE:
-             copyString(currentState, "RUNNING");
-             break;
+    queue->shutdown = true;
 
-          case BLOCKED_STATE:
-             copyString(currentState, "BLOCKED");
-             break;
+    pthread_cond_broadcast(&queue->eventSignal);
 
-          case EXIT_STATE:
-             copyString(currentState, "EXIT");
-             break;
-         }
-       
-       // get the desired state of the process
-       switch (stateCode)
-         {
-          case READY_STATE:
-             copyString(setState, "READY");
-             break;
+    pthread_mutex_unlock(&queue->eventLock);
 
-          case RUNNING_STATE:
-             copyString(setState, "RUNNING");
-             break;
+    for (index = 0; index < queue->workerCount; index++)
+      {
+       pthread_join(queue->workers[index], NULL);
+      }
 
-          case BLOCKED_STATE:
-             copyString(setState, "BLOCKED");
-             break;
+    free(queue->workers);
 
-          case EXIT_STATE:
-             copyString(setState, "EXIT");
-             break;
-         }
-       
-       // generate state change string
-       sprintf(outputSegment, "Process %d set from %s to %s\n", 
-                                    prcPtr->processId, currentState, setState);
-      }
-    // check if OS output is related to the rest of the sim functions
-    else if (osCode != IGNORE_OSCODE)
-      {
-       // determine the type of OS output
-       switch (osCode)
-         {
-          // generate process selection string
-          case PROCESS_START:
-             sprintf(outputSegment, 
-                  "Process %d selected with %d ms remaining\n", 
-                                    prcPtr->processId, prcPtr->processRunTime);
-             
-             break;
-          
-          // generate process termination string
-          case PROCESS_END:
-            // check if process termination is related to memory failiure
-            if (memCode == ACCESS_FAILIURE || memCode == ALLOCATE_FAILIURE)
-               {
-                concatenateString(displayString, "Segmentation fault, ");
-               }
+    pthread_cond_destroy(&queue->eventSignal);
 
-             sprintf(outputSegment, "Process %d ended\n", prcPtr->processId);
-             
-             break;
-          
-          // generate simulation start string
-          case SIM_START:
-             sprintf(outputSegment, "Simulator Start\n");
-             break;
-          
-          // generate simulation end string
-          case SIM_END:
-             sprintf(outputSegment, "Simulator End\n");
-             break;
-          
-          // generate system stop string
-          case SYS_STOP:
-             sprintf(outputSegment, "System Stop\n");
-             break;
-          
-          // generate process interrupt string
-          case CPU_INTERRUPT:
-             sprintf(outputSegment, 
-                        "Interrupted by Process %d, %s %sput operation\n", 
-                                    prcPtr->processId, prcPtr->opHeadPtr->strArg1, 
-                                                            prcPtr->opHeadPtr->inOutArg);
-             break;
-          
-          // generate process blocked string
-          case BLOCKED_IO:
-             sprintf(outputSegment, 
-                        "Process %d blocked for %sput operation\n",
-                              prcPtr->processId, prcPtr->opHeadPtr->inOutArg);
-             break;
-          
-          // generate quantum cycle reached string
-          case CPU_QUANTUM:
-             sprintf(outputSegment,
-                        "Process %d quantum time out, cpu process operation end\n",
-                                                                     prcPtr->processId);
-             break;
-         }
-      }
-    
-    // whatever string is generated, concatenate it to the timestamp part generated at the beginning
-    concatenateString(displayString, outputSegment);
-    
-    // set boolean for last ouput is OS to true. This sets the spacing between OS and process outputs
-    *lastMsgOS = true;
-    
-    // call display command to determine where the generated output goes
-    return displayCommand(logHeadPtr, displayString, displayCode);
+    pthread_mutex_destroy(&queue->eventLock);
+
+    free(queue->heap);
+
+    free(queue);
+
+    return NULL;
    }
 
-// function for generating process/op code related output
-logFileType *processStringEngine(OpCodeType *opWkgPtr, logFileType *logHeadPtr,
-                                          int prcId, int cmdType, int displayCode, 
-                                          char *displayString, bool isPreemptive, 
-                                                                  bool *lastMsgOS)
+// creates the event queue with a pool of io workers to deliver 
+// completions in real time, none when the main loop delivers them
+eventQueueType *createEventQueue(SimTimerType *timerPtr,
+             InterruptQueueType *interruptQueue, int capacity, int workerCount)
    {
     // initialize function/variables
-    char outputSegment[STD_STR_LEN], totalTime[MIN_STR_LEN];
-    
-    // get current runtime of the simulation
-    accessTimer(LAP_TIMER, totalTime);
-    
-    // check if the last output to be generated was OS
-    if (*lastMsgOS)
+    int index;
+    pthread_condattr_t signalAttr;
+    eventQueueType *queue = (eventQueueType *)malloc(sizeof(eventQueueType));
+
+    // allocate the heap, one pending event per process is the usual maximum
+    queue->capacity = capacity;
+
+    queue->heap = (eventType *)malloc(capacity * sizeof(eventType));
+
+    queue->eventCount = 0;
+
+    queue->nextSequence = 0;
+
+    queue->shutdown = false;
+
+    queue->timerPtr = timerPtr;
+
+    queue->interruptQueue = interruptQueue;
+
+    // timed waits are measured against the monotonic clock of the timer
+    pthread_condattr_init(&signalAttr);
+
+    pthread_condattr_setclock(&signalAttr, CLOCK_MONOTONIC);
+
+    pthread_cond_init(&queue->eventSignal, &signalAttr);
+
+    pthread_condattr_destroy(&signalAttr);
+
+    pthread_mutex_init(&queue->eventLock, NULL);
+
+    // start the io workers
+    queue->workerCount = workerCount;
+
+    queue->workers = (pthread_t *)malloc((workerCount + 1) * sizeof(pthread_t));
+
+    for (index = 0; index < workerCount; index++)
       {
-       // if so add an extra \n char for correct spacing between messages
-       sprintf(displayString, "\n%s, Process: %d, ", totalTime, prcId);
+       pthread_create(&queue->workers[index], NULL, handleIO, (void *)queue);
       }
-    // otherwise leave the extra \n out of the string
-   else
+
+    return queue;
+   }
+
+// finds how many cpu cycles can run before the quantum expires, the
+// operation ends or the next io completion is noticed at a cycle boundary
+int cyclesToHorizon(long long eventTime, long long currentTime, int cycleRate,
+                                              int quantumCycles, int opCycles)
+   {
+    // initialize function/variables
+    long long cycleNSec = cycleRate * NSEC_PER_MSEC, eventCycles;
+    int horizon = quantumCycles;
+
+    // take the earlier of the quantum and operation end
+    if (opCycles < horizon)
       {
-       sprintf(displayString, "%s, Process: %d, ", totalTime, prcId);
+       horizon = opCycles;
       }
-    
-    // check for cpu op code
-    if (compareString(opWkgPtr->command, "cpu") == STR_EQ)
+
+    // check for a pending io completion
+    if (eventTime != EMPTY_QUEUE_VALUE)
       {
-       // generate cpu start string
-       if (cmdType == COMMAND_START)
+       // round up to the first cycle boundary at or after the completion,
+       // an overdue completion still costs the cycle that notices it
+       eventCycles = (eventTime - currentTime + cycleNSec - 1) / cycleNSec;
+
+       if (eventCycles < 1)
          {
-          sprintf(outputSegment, "cpu process operation start\n");
+          eventCycles = 1;
          }
-       // generate cpu end string
-       else if (cmdType == COMMAND_END)
+
+       if (eventCycles < horizon)
          {
-          sprintf(outputSegment, "cpu process operation end\n");
+          horizon = (int)eventCycles;
          }
       }
-    // check for device op code
-    else if (compareString(opWkgPtr->command, "dev") == STR_EQ)
+
+    // return the number of cycles to run
+    return horizon;
+   }
+
+// raises the io completion interrupt for a process, the event lock 
+// must not be held as a disk completion adds the disk's next request
+void deliverEvent(eventQueueType *queue, eventType *eventPtr)
+   {
+    // start the next request waiting on the disk
+    if (eventPtr->diskPtr != NULL)
       {
-       // generate device start string
-       if (cmdType == COMMAND_START)
-         {
-          sprintf(outputSegment, "%s %sput operation start\n", 
-                                       opWkgPtr->strArg1, opWkgPtr->inOutArg);
-         }
-       // check if the scheduling is preemptive
-       if (isPreemptive)
-         {
-          concatenateString(outputSegment, "\n");
-         }
-       
-       // generate device end string
-       else if (cmdType == COMMAND_END)
-         {
-          sprintf(outputSegment, "%s %sput operation end\n", 
-                                       opWkgPtr->strArg1, opWkgPtr->inOutArg);
-         }
+       completeDiskRequest(eventPtr->diskPtr, queue, eventPtr->eventTime);
       }
-    // otherwise assume memory op code
-    else
+
+    // raise the interrupt for the completed io operation, the interrupt
+    // queue is safe for any number of workers to add to at once
+    interruptManager(eventPtr->prcPtr, queue->interruptQueue,
+                                             IGNORE_INTER_PARAM, ADD_TO_QUEUE);
+   }
+
+// moves every event due by the current time into the interrupt queue,
+// in time order
+void deliverEvents(eventQueueType *queue, long long currentTime)
+   {
+    // initialize function/variables
+    eventType event;
+    bool eventDue = true;
+
+    // loop while the earliest event has completed
+    while (eventDue)
       {
-       // generate the memory allocate/access string
-       if (cmdType == COMMAND_START)
+       pthread_mutex_lock(&queue->eventLock);
+
+       eventDue = queue->eventCount > 0 
+                        && queue->heap[FIRST_INDEX].eventTime <= currentTime;
+
+       if (eventDue)
          {
-          if (compareString(opWkgPtr->strArg1, "allocate") == STR_EQ)
-            {
-             sprintf(outputSegment, "mem allocate request (%d, %d)\n", 
-                                          opWkgPtr->intArg2, opWkgPtr->intArg3);
-            }
-          else if (compareString(opWkgPtr->strArg1, "access") == STR_EQ)
-            {
-             sprintf(outputSegment, "mem access request (%d, %d)\n", 
-                                          opWkgPtr->intArg2, opWkgPtr->intArg3);
-            }
+          event = popEvent(queue);
          }
-       // generate the memory result string
-       else
-         {
-          switch (cmdType)
-            {
-             case ALLOCATE_SUCCESS:
-                sprintf(outputSegment, "successful mem allocate request\n");
-                break;
 
-             case ALLOCATE_FAILIURE:
-                sprintf(outputSegment, "failed mem allocate request\n");
-                break;
+       pthread_mutex_unlock(&queue->eventLock);
 
-             case ACCESS_SUCCESS:
-                sprintf(outputSegment, "successful mem access request\n");
-                break;
-
-             case ACCESS_FAILIURE:
-                sprintf(outputSegment, "failed mem access request\n");
-                break;
-            }
+       // deliver outside the lock, a disk completion may add an event
+       if (eventDue)
+         {
+          deliverEvent(queue, &event);
          }
       }
-    
-    // add whatever generated string to the timestamp
-    concatenateString(displayString, outputSegment);
-    
-    // set the last message OS type flag to false
-    *lastMsgOS = false;
-    
-    // call display command to handle string output
-    logHeadPtr = displayCommand(logHeadPtr, displayString, displayCode);
-    
-    // return the log file linked list head pointer
-    return logHeadPtr;
    }
 
-// function for writing log file linked list to log file
-void writeToFile(logFileType *logPtr, ConfigDataType *cfgPtr, 
-                                                            char *displayString)
+// orders events by completion time, then by the order they were added
+bool eventBefore(eventType *oneEvent, eventType *otherEvent)
    {
-    // initialize function/variables
-    FILE *logFile;
-    
-    // check for log file output code
-    if (cfgPtr->logToCode == LOGTO_FILE_CODE || cfgPtr->logToCode == LOGTO_BOTH_CODE)
+    return oneEvent->eventTime < otherEvent->eventTime
+             || (oneEvent->eventTime == otherEvent->eventTime 
+                                  && oneEvent->sequence < otherEvent->sequence);
+   }
+
+// returns the completion time of the earliest pending event
+long long nextEventTime(eventQueueType *queue)
+   {
+    // initialize function/variables
+    long long eventTime = EMPTY_QUEUE_VALUE;
+
+    pthread_mutex_lock(&queue->eventLock);
+
+    // check for a pending event
+    if (queue->eventCount > 0)
       {
-       
-       // point file pointer to opened/created logfile
-       logFile = fopen(cfgPtr->logToFileName, WRITE);
-       
-       // check if file open was a success
-       if (logFile)
+       eventTime = queue->heap[FIRST_INDEX].eventTime;
+      }
+
+    pthread_mutex_unlock(&queue->eventLock);
+
+    return eventTime;
+   }
+
+// removes and returns the earliest event, event lock must be held
+eventType popEvent(eventQueueType *queue)
+   {
+    // initialize function/variables
+    int index = FIRST_INDEX, child;
+    eventType earliest = queue->heap[FIRST_INDEX], last;
+
+    // take the last event out to refill the root
+    queue->eventCount--;
+
+    last = queue->heap[queue->eventCount];
+
+    // sift the last event down from the root
+    child = index * 2 + 1;
+
+    while (child < queue->eventCount)
+      {
+       // pick the earlier of the two children
+       if (child + 1 < queue->eventCount 
+                 && eventBefore(&queue->heap[child + 1], &queue->heap[child]))
          {
-          // print all relevant configuration file data
-          fprintf(logFile, 
-                     "==================================================\n");
+          child++;
+         }
 
-          fprintf(logFile, "File Name                       : %s\n", 
-                                                      cfgPtr->metaDataFileName);
+       if (!eventBefore(&queue->heap[child], &last))
+         {
+          break;
+         }
 
-          configCodeToString(cfgPtr->cpuSchedCode, displayString);
+       queue->heap[index] = queue->heap[child];
 
-          fprintf(logFile, "CPU Scheduling                  : %s\n", 
-                                                               displayString);
+       index = child;
 
-          fprintf(logFile, "Quantum Cycles                  : %d\n", 
-                                                         cfgPtr->quantumCycles);
+       child = index * 2 + 1;
+      }
 
-          fprintf(logFile, "Memory Available (KB)           : %d\n", 
-                                                         cfgPtr->memAvailable);
+    queue->heap[index] = last;
 
-          fprintf(logFile, "Processor Cycle Rate (ms/cycle) : %d\n", 
-                                                         cfgPtr->procCycleRate);
+    return earliest;
+   }
 
-          fprintf(logFile, "I/O Cycle Rate (ms/cycle)       : %d\n", 
-                                                         cfgPtr->ioCycleRate);
 
-          fprintf(logFile, "================\n");
-          
-          // iterate through log file linked list
-          while (logPtr != NULL)
+//////////////////////////////
+//     DEVICE FUNCTIONS     //
+//////////////////////////////
+
+// frees the device servers
+deviceServerType *clearDeviceServers(deviceServerType *servers)
+   {
+    // initialize function/variables
+    int deviceCode;
+
+    for (deviceCode = 0; deviceCode < DEVICE_COUNT; deviceCode++)
+      {
+       free(servers[deviceCode].unitFreeTime);
+      }
+
+    free(servers);
+
+    return NULL;
+   }
+
+// creates one server per device with the configured number of units
+deviceServerType *createDeviceServers(ConfigDataType *configPtr)
+   {
+    // initialize function/variables
+    int deviceCode, unit;
+    deviceServerType *servers = (deviceServerType *)malloc(DEVICE_COUNT
+                                                   * sizeof(deviceServerType));
+
+    // loop across the devices
+    for (deviceCode = 0; deviceCode < DEVICE_COUNT; deviceCode++)
+      {
+       servers[deviceCode].unitCount = configPtr->deviceUnits[deviceCode];
+
+       servers[deviceCode].unitFreeTime = NULL;
+
+       servers[deviceCode].queueWaitNSec = 0;
+
+       servers[deviceCode].queuedOps = 0;
+
+       // every unit starts free
+       if (servers[deviceCode].unitCount > 0)
+         {
+          servers[deviceCode].unitFreeTime
+             = (long long *)malloc(servers[deviceCode].unitCount
+                                                          * sizeof(long long));
+
+          for (unit = 0; unit < servers[deviceCode].unitCount; unit++)
             {
-             // add each node to the file
-             fprintf(logFile, "%s", logPtr->opCommand);
-             
-             // iterate to the next node
-             logPtr = logPtr->nextCommand;
+             servers[deviceCode].unitFreeTime[unit] = 0;
             }
-          
-          // add simulation end output
-          fprintf(logFile, "\nEnd Simulation - Complete\n");
+         }
+      }
 
-          fprintf(logFile, "=========================\n");
-          
-          // close the file
-          fclose(logFile);
+    return servers;
+   }
+
+// queues an io operation on its device and returns when it completes,
+// operations arrive in simulation time order so taking the unit that
+// frees up first serves the device queue first come first served
+long long scheduleDeviceOp(deviceServerType *servers, const char *deviceName,
+                                  long long arrivalTime, long long serviceTime)
+   {
+    // initialize function/variables
+    int deviceCode = getDeviceCode(deviceName), unit, freeUnit = FIRST_INDEX;
+    deviceServerType *server;
+    long long startTime = arrivalTime;
+
+    // unknown or unlimited devices start the operation at once
+    if (deviceCode == DEVICE_COUNT || servers[deviceCode].unitCount == 0)
+      {
+       return arrivalTime + serviceTime;
+      }
+
+    server = &servers[deviceCode];
+
+    // find the unit that frees up first
+    for (unit = 1; unit < server->unitCount; unit++)
+      {
+       if (server->unitFreeTime[unit] < server->unitFreeTime[freeUnit])
+         {
+          freeUnit = unit;
          }
       }
+
+    // wait in the device queue if every unit is busy
+    if (server->unitFreeTime[freeUnit] > arrivalTime)
+      {
+       startTime = server->unitFreeTime[freeUnit];
+
+       server->queueWaitNSec += startTime - arrivalTime;
+
+       server->queuedOps++;
+      }
+
+    server->unitFreeTime[freeUnit] = startTime + serviceTime;
+
+    return startTime + serviceTime;
    }
 
 
 //////////////////////////////
-//     MEMORY FUNCTIONS     //
+//      DISK FUNCTIONS      //
 //////////////////////////////
 
-// function for adding a new simulated memory allocation
-memoryType *addMemoryNode(memoryType *memPtr, int prcId, int memBase, 
-                                                               int memOffset)
+// frees the disk model and any requests still waiting
+diskType *clearDisk(diskType *diskPtr)
    {
-    // check if the current parameter pointer is NULL
-    if (memPtr == NULL)
+    // initialize function/variables
+    diskRequestType *requestPtr;
+
+    // check for a disk to free
+    if (diskPtr != NULL)
       {
-       // allocate new memory node
-       memPtr = (memoryType *)malloc(sizeof(memoryType));
-       
-       // assign relevant info from parameters
-       memPtr->processId = prcId;
+       while (diskPtr->queueHead != NULL)
+         {
+          requestPtr = diskPtr->queueHead->nextRequest;
 
-       memPtr->memBase = memBase;
+          free(diskPtr->queueHead);
 
-       memPtr->memOffset = memOffset - MEM_SHIFT;
-       
-       // point the next node pointer to NULL
-       memPtr->nextBlock = NULL;
-       
-       // return the newly allocated node
-       return memPtr;
+          diskPtr->queueHead = requestPtr;
+         }
+
+       pthread_mutex_destroy(&diskPtr->diskLock);
+
+       free(diskPtr);
       }
-    
-    // point the next node pointer to the result of recursive function call
-    memPtr->nextBlock = addMemoryNode(memPtr->nextBlock, prcId, memBase, 
-                                                                     memOffset);
-    
-    // return the head pointer
-    return memPtr;
+
+    return NULL;
+   }
+
+// frees the head when a request completes and starts the next one
+void completeDiskRequest(diskType *diskPtr, eventQueueType *queue, 
+                                                     long long completionTime)
+   {
+    pthread_mutex_lock(&diskPtr->diskLock);
+
+    diskPtr->busy = false;
+
+    // start the next request the scheduler picks
+    if (diskPtr->queueHead != NULL)
+      {
+       dispatchDiskRequest(diskPtr, queue, completionTime);
+      }
+
+    pthread_mutex_unlock(&diskPtr->diskLock);
    }
 
-// function for clearing entire memory linked list
-memoryType *clearMemory(memoryType *memPtr)
+// creates the disk model, none unless a disk scheduler is selected
+diskType *createDisk(ConfigDataType *configPtr)
    {
     // initialize function/variables
-    memoryType *temp;
-    
-    // iterate through the linked list
-    while (memPtr != NULL)
+    diskType *diskPtr;
+
+    // check for no disk model
+    if (configPtr->diskSchedCode == DISK_NONE_CODE)
       {
-       // point temp pointer to current pointer
-       temp = memPtr;
+       return NULL;
+      }
 
-       // point current pointer to next node pointer
-       memPtr = memPtr->nextBlock;
+    diskPtr = (diskType *)malloc(sizeof(diskType));
 
-       // free the temp pointer
-       free(temp);
+    diskPtr->schedCode = configPtr->diskSchedCode;
+
+    diskPtr->cylinderCount = configPtr->diskCylinders;
+
+    diskPtr->seekNSec = (long long)configPtr->diskSeekUSec * NSEC_PER_USEC;
+
+    // the head starts at the outer cylinder sweeping inward
+    diskPtr->headCylinder = 0;
+
+    diskPtr->headUp = true;
+
+    diskPtr->busy = false;
+
+    diskPtr->queueHead = NULL;
+
+    diskPtr->queueTail = NULL;
+
+    diskPtr->headTravel = 0;
+
+    diskPtr->requestCount = 0;
+
+    pthread_mutex_init(&diskPtr->diskLock, NULL);
+
+    return diskPtr;
+   }
+
+// moves the head to the next request and schedules its completion, 
+// disk lock must be held
+void dispatchDiskRequest(diskType *diskPtr, eventQueueType *queue,
+                                                                long long time)
+   {
+    // initialize function/variables
+    diskRequestType *requestPtr;
+    int startCylinder = diskPtr->headCylinder;
+    long long travel, startTime;
+
+    // pick the request, this may move the head to the end of a sweep
+    requestPtr = selectDiskRequest(diskPtr, time);
+
+    // an idle disk starts the request when it arrives
+    startTime = time;
+
+    if (requestPtr->arrivalTime > startTime)
+      {
+       startTime = requestPtr->arrivalTime;
       }
-    
-    // return NULL
-    return NULL;
+
+    // charge the seek by the distance the head travels
+    travel = (long long)(diskPtr->headCylinder - startCylinder);
+
+    if (travel < 0)
+      {
+       travel = -travel;
+      }
+
+    if (requestPtr->cylinder > diskPtr->headCylinder)
+      {
+       travel += requestPtr->cylinder - diskPtr->headCylinder;
+      }
+    else
+      {
+       travel += diskPtr->headCylinder - requestPtr->cylinder;
+      }
+
+    diskPtr->headCylinder = requestPtr->cylinder;
+
+    diskPtr->headTravel += travel;
+
+    diskPtr->requestCount++;
+
+    diskPtr->busy = true;
+
+    // the request completes after the seek and the transfer
+    addEvent(queue, requestPtr->prcPtr, diskPtr,
+            startTime + travel * diskPtr->seekNSec + requestPtr->transferNSec);
+
+    free(requestPtr);
+   }
+
+// removes the next request to serve from the disk queue, considering the
+// requests arrived by the given time, or the earliest if none has,
+// disk lock must be held
+diskRequestType *selectDiskRequest(diskType *diskPtr, long long time)
+   {
+    // initialize function/variables
+    diskRequestType *wkgPtr, *prevPtr = NULL, *bestPtr = NULL,
+                                                           *bestPrevPtr = NULL;
+    int head = diskPtr->headCylinder, bestKey = 0, key;
+    bool ahead, bestAhead = false;
+
+    // an idle disk serves the earliest arrival once nothing has arrived
+    if (diskPtr->queueHead->arrivalTime > time)
+      {
+       time = diskPtr->queueHead->arrivalTime;
+      }
+
+    // loop across the arrived requests, earliest first
+    for (wkgPtr = diskPtr->queueHead; 
+               wkgPtr != NULL && wkgPtr->arrivalTime <= time; 
+                                prevPtr = wkgPtr, wkgPtr = wkgPtr->nextRequest)
+      {
+       // check for a request in the head's sweep direction
+       ahead = diskPtr->headUp ? wkgPtr->cylinder >= head 
+                               : wkgPtr->cylinder <= head;
+
+       // distance from the head, FCFS keeps arrival order
+       key = wkgPtr->cylinder > head ? wkgPtr->cylinder - head 
+                                     : head - wkgPtr->cylinder;
+
+       switch (diskPtr->schedCode)
+         {
+          // first come first served, the earliest is already first
+          case DISK_FCFS_CODE:
+             key = 0;
+             break;
+
+          // C-LOOK sweeps upward then jumps to the lowest cylinder
+          case DISK_CLOOK_CODE:
+             ahead = wkgPtr->cylinder >= head;
+
+             if (!ahead)
+               {
+                key = wkgPtr->cylinder;
+               }
+             break;
+         }
+
+       // SCAN and C-LOOK prefer requests ahead of the head, SSTF and 
+       // FCFS treat every request alike, ties go to the earlier arrival
+       if (diskPtr->schedCode == DISK_FCFS_CODE 
+                                  || diskPtr->schedCode == DISK_SSTF_CODE)
+         {
+          ahead = true;
+         }
+
+       if (bestPtr == NULL || (ahead && !bestAhead) 
+                           || (ahead == bestAhead && key < bestKey))
+         {
+          bestPtr = wkgPtr;
+          bestPrevPtr = prevPtr;
+          bestKey = key;
+          bestAhead = ahead;
+         }
+      }
+
+    // SCAN runs to the end of the disk before reversing
+    if (diskPtr->schedCode == DISK_SCAN_CODE && !bestAhead)
+      {
+       diskPtr->headCylinder = diskPtr->headUp ? diskPtr->cylinderCount - 1 : 0;
+
+       diskPtr->headUp = !diskPtr->headUp;
+
+       // the nearest request behind is the first on the way back
+       bestPtr = NULL;
+
+       prevPtr = NULL;
+
+       for (wkgPtr = diskPtr->queueHead; 
+                  wkgPtr != NULL && wkgPtr->arrivalTime <= time; 
+                                prevPtr = wkgPtr, wkgPtr = wkgPtr->nextRequest)
+         {
+          key = wkgPtr->cylinder > diskPtr->headCylinder 
+                               ? wkgPtr->cylinder - diskPtr->headCylinder 
+                                     : diskPtr->headCylinder - wkgPtr->cylinder;
+
+          if (bestPtr == NULL || key < bestKey)
+            {
+             bestPtr = wkgPtr;
+             bestPrevPtr = prevPtr;
+             bestKey = key;
+            }
+         }
+      }
+
+    // unlink the request from the queue
+    if (bestPrevPtr == NULL)
+      {
+       diskPtr->queueHead = bestPtr->nextRequest;
+      }
+    else
+      {
+       bestPrevPtr->nextRequest = bestPtr->nextRequest;
+      }
+
+    if (diskPtr->queueTail == bestPtr)
+      {
+       diskPtr->queueTail = bestPrevPtr;
+      }
+
+    return bestPtr;
+   }
+
+// adds a hard drive request to the disk queue, starting it at once if
+// the head is free
+void submitDiskRequest(diskType *diskPtr, eventQueueType *queue,
+                      processType *prcPtr, int cylinder, long long arrivalTime,
+                                                        long long transferNSec)
+   {
+    // initialize function/variables
+    diskRequestType *requestPtr 
+                        = (diskRequestType *)malloc(sizeof(diskRequestType));
+
+    // targets past the last cylinder are served at the last cylinder
+    if (cylinder >= diskPtr->cylinderCount)
+      {
+       cylinder = diskPtr->cylinderCount - 1;
+      }
+
+    requestPtr->prcPtr = prcPtr;
+
+    requestPtr->cylinder = cylinder;
+
+    requestPtr->arrivalTime = arrivalTime;
+
+    requestPtr->transferNSec = transferNSec;
+
+    requestPtr->nextRequest = NULL;
+
+    pthread_mutex_lock(&diskPtr->diskLock);
+
+    // append in arrival order
+    if (diskPtr->queueTail == NULL)
+      {
+       diskPtr->queueHead = requestPtr;
+      }
+    else
+      {
+       diskPtr->queueTail->nextRequest = requestPtr;
+      }
+
+    diskPtr->queueTail = requestPtr;
+
+    // start the request if the head is free
+    if (!diskPtr->busy)
+      {
+       dispatchDiskRequest(diskPtr, queue, arrivalTime);
+      }
+
+    pthread_mutex_unlock(&diskPtr->diskLock);
+   }
+
+
+//////////////////////////////
+//    LOGFILE FUNCTIONS     //
+//////////////////////////////
+
+// starts a new chunk at the end of the log, reusing a written chunk
+// when possible
+logChunkType *addLogChunk(logFileType *logPtr)
+   {
+    // initialize function/variables
+    logChunkType *chunkPtr;
+
+    // take a written chunk off the free list
+    pthread_mutex_lock(&logPtr->logLock);
+
+    chunkPtr = logPtr->freeChunks;
+
+    if (chunkPtr != NULL)
+      {
+       logPtr->freeChunks = chunkPtr->nextChunk;
+      }
+
+    pthread_mutex_unlock(&logPtr->logLock);
+
+    // otherwise allocate a new one
+    if (chunkPtr == NULL)
+      {
+       chunkPtr = (logChunkType *)malloc(sizeof(logChunkType) + LOG_CHUNK_SIZE);
+
+       chunkPtr->capacity = LOG_CHUNK_SIZE / sizeof(traceRecordType);
+      }
+
+    chunkPtr->used = 0;
+
+    chunkPtr->nextChunk = NULL;
+
+    logPtr->tailChunk = chunkPtr;
+
+    return chunkPtr;
+   }
+
+// appends an event record to the end of the log, passing the tail chunk 
+// to the writer once it is full
+logFileType *appendLogRecord(logFileType *logPtr,
+                                              const traceRecordType *recordPtr)
+   {
+    // initialize function/variables
+    logChunkType *chunkPtr;
+
+    // check for no log file open
+    if (logPtr == NULL)
+      {
+       return NULL;
+      }
+
+    // start a new chunk when the tail is full
+    chunkPtr = logPtr->tailChunk;
+
+    if (chunkPtr == NULL || chunkPtr->used == chunkPtr->capacity)
+      {
+       submitLogChunk(logPtr);
+
+       chunkPtr = addLogChunk(logPtr);
+      }
+
+    // copy the record onto the end of the chunk
+    chunkPtr->records[chunkPtr->used] = *recordPtr;
+
+    chunkPtr->used++;
+
+    return logPtr;
+   }
+
+// writes out the rest of the log and the footer, stops the writer and
+// closes the log file
+logFileType *closeLogFile(logFileType *logPtr)
+   {
+    // initialize function/variables
+    logChunkType *temp;
+    
+    // check if a log file was opened
+    if (logPtr != NULL)
+      {
+       // hand over the last partial chunk
+       submitLogChunk(logPtr);
+
+       // let the writer finish the queue and stop
+       pthread_mutex_lock(&logPtr->logLock);
+
+       logPtr->shutdown = true;
+
+       pthread_cond_signal(&logPtr->chunkSignal);
+
+       pthread_mutex_unlock(&logPtr->logLock);
+
+       pthread_join(logPtr->writerThread, NULL);
+
+       // add simulation end output, trace files end with their last record
+       if (logPtr->logToCode == LOGTO_CHROME_CODE)
+         {
+          writeChromeFooter(logPtr->filePtr);
+         }
+       else if (logPtr->logToCode != LOGTO_TRACE_CODE)
+         {
+          fprintf(logPtr->filePtr, "\nEnd Simulation - Complete\n");
+
+          fprintf(logPtr->filePtr, "=========================\n");
+         }
+          
+       // close the file
+       fclose(logPtr->filePtr);
+
+       // loop across the chunks kept for reuse
+       while (logPtr->freeChunks != NULL)
+         {
+          // point temp to the current chunk
+          temp = logPtr->freeChunks;
+          
+          // move the head to the next chunk
+          logPtr->freeChunks = temp->nextChunk;
+
+          // free the current chunk
+          free(temp);
+         }
+
+       pthread_cond_destroy(&logPtr->spaceSignal);
+
+       pthread_cond_destroy(&logPtr->chunkSignal);
+
+       pthread_mutex_destroy(&logPtr->logLock);
+
+       free(logPtr);
+      }
+
+    return NULL;
+   }
+
+// checks an event passes the configured log level, and that process
+// events pass the event class and process filters
+bool logEventShown(ConfigDataType *cfgPtr, int logLevel, int eventClass,
+                                                                 int processId)
+   {
+    return logLevel <= cfgPtr->logLevelCode
+             && (eventClass == LOG_EVENT_NONE
+                   || ((eventClass & cfgPtr->logEventMask) != 0
+                         && processId >= cfgPtr->logFirstPid
+                         && (cfgPtr->logLastPid == LOG_ALL_PROCESSES 
+                                         || processId <= cfgPtr->logLastPid)));
+   }
+
+// function for sending an event record to its outputs, the monitor
+// shows it formatted now and a log file stores it for the writer thread
+// to format
+logFileType *logTraceRecord(logFileType *logPtr, traceRecordType *recordPtr,
+                         int displayCode, char *displayString, bool *lastMsgOS)
+   {
+    // check the display code type for monitor output
+    if (displayCode == LOGTO_MONITOR_CODE || displayCode == LOGTO_BOTH_CODE)
+      {
+       formatTraceRecord(recordPtr, displayString, lastMsgOS);
+
+       // buffer the output, it is shown at idle, simulation end or 
+       // once the monitor buffer fills
+       fputs(displayString, stdout);
+      }
+
+    // store the record with any open log file
+    return appendLogRecord(logPtr, recordPtr);
+   }
+
+// function for generating the placement of a buddy allocation and its
+// internal fragmentation, the allocation is the last block added
+logFileType *memRecordEngine(logFileType *logHeadPtr, SimTimerType *timerPtr,
+                   int prcId, memoryMapType *memMapPtr, ConfigDataType *cfgPtr,
+                                          char *displayString, bool *lastMsgOS)
+   {
+    // initialize function/variables
+    traceRecordType record = { 0 };
+
+    // drop filtered events before reading the timer
+    if (!logEventShown(cfgPtr, LOG_LEVEL_MEMORY_CODE, LOG_EVENT_MEMORY, prcId))
+      {
+       return logHeadPtr;
+      }
+
+    record.kind = TRACE_MEM_PLACED;
+    record.timeNSec = accessTimer(timerPtr, LAP_TIMER);
+    record.processId = prcId;
+    record.device = DEVICE_COUNT;
+    record.arg = memMapPtr->tailBlock->physBase;
+    record.value = memMapPtr->lastWaste;
+
+    return logTraceRecord(logHeadPtr, &record, cfgPtr->logToCode,
+                                                     displayString, lastMsgOS);
+   }
+
+// function for generating OS output that is not tied to a process, the
+// idle notices, spacing lines and end of simulation summaries
+logFileType *osRecordEngine(logFileType *logHeadPtr, int traceKind,
+            long long timeNSec, int deviceCode, long long value, long long arg,
+                  ConfigDataType *cfgPtr, char *displayString, bool *lastMsgOS)
+   {
+    // initialize function/variables
+    traceRecordType record = { 0 };
+
+    // spacing lines belong with the process output they separate
+    int logLevel = traceKind == TRACE_BLANK_LINE ? LOG_LEVEL_PROCESS_CODE
+                                                           : LOG_LEVEL_OS_CODE;
+
+    // drop filtered events before any formatting
+    if (!logEventShown(cfgPtr, logLevel, LOG_EVENT_NONE, 0))
+      {
+       return logHeadPtr;
+      }
+
+    record.kind = traceKind;
+    record.timeNSec = timeNSec;
+    record.device = deviceCode;
+    record.value = value;
+    record.arg = arg;
+
+    return logTraceRecord(logHeadPtr, &record, cfgPtr->logToCode,
+                                                     displayString, lastMsgOS);
+   }
+
+// function for generating OS related output
+logFileType *osStringEngine(processType *prcPtr, logFileType *logHeadPtr,
+     SimTimerType *timerPtr, ConfigDataType *cfgPtr, int osCode, int stateCode,
+          int memCode, char *displayString, bool isPreemptive, bool *lastMsgOS)
+   {
+    // initialize function/variables
+    traceRecordType record = { 0 };
+    int logLevel = LOG_LEVEL_PROCESS_CODE, eventClass = LOG_EVENT_STATE;
+
+    // state changes take the fast path
+    if (stateCode != IGNORE_STATE)
+      {
+       return logStateChange(prcPtr, logHeadPtr, timerPtr, cfgPtr, stateCode,
+                                       displayString, isPreemptive, lastMsgOS);
+      }
+
+    // find the level and class of the event
+    switch (osCode)
+      {
+       // simulation wide output is OS level and has no process
+       case SIM_START:
+       case SIM_END:
+       case SYS_STOP:
+          logLevel = LOG_LEVEL_OS_CODE;
+          eventClass = LOG_EVENT_NONE;
+          break;
+
+       case CPU_INTERRUPT:
+       case BLOCKED_IO:
+          eventClass = LOG_EVENT_IO;
+          break;
+
+       case CPU_QUANTUM:
+          eventClass = LOG_EVENT_CPU;
+          break;
+      }
+
+    // drop filtered events before any formatting
+    if (!logEventShown(cfgPtr, logLevel, eventClass, 
+                                        prcPtr != NULL ? prcPtr->processId : 0))
+      {
+       return logHeadPtr;
+      }
+    
+    // get current runtime of simulation
+    record.timeNSec = accessTimer(timerPtr, LAP_TIMER);
+
+    record.isPreemptive = isPreemptive;
+
+    record.device = DEVICE_COUNT;
+
+    // check for a running process readied by the scheduler
+    if (osCode == CPU_PREEMPT)
+      {
+       record.kind = TRACE_OS_PREEMPT;
+       record.processId = prcPtr->processId;
+       record.detail = RUNNING_STATE;
+       record.code = READY_STATE;
+      }
+    // check if OS output is related to the rest of the sim functions
+    else if (osCode != IGNORE_OSCODE)
+      {
+       record.kind = TRACE_OS_EVENT;
+       record.code = osCode;
+
+       // simulation wide output has no process
+       if (prcPtr != NULL)
+         {
+          record.processId = prcPtr->processId;
+         }
+
+       switch (osCode)
+         {
+          // record the run time of a selected process
+          case PROCESS_START:
+             record.arg = prcPtr->processRunTime;
+             break;
+
+          // record any memory failiure ending the process
+          case PROCESS_END:
+             record.arg = memCode;
+             break;
+
+          // record the device operation interrupting or blocking
+          case CPU_INTERRUPT:
+          case BLOCKED_IO:
+             record.device = getDeviceCode(prcPtr->opHeadPtr->strArg1);
+             record.isOutput = compareString(prcPtr->opHeadPtr->inOutArg,
+                                                              "out") == STR_EQ;
+             break;
+         }
+      }
+    
+    // call the record logger to determine where the output goes
+    return logTraceRecord(logHeadPtr, &record, cfgPtr->logToCode,
+                                                     displayString, lastMsgOS);
+   }
+
+// function for generating process/op code related output
+logFileType *processStringEngine(OpCodeType *opWkgPtr, logFileType *logHeadPtr,
+        SimTimerType *timerPtr, int prcId, int cmdType, ConfigDataType *cfgPtr,
+                       char *displayString, bool isPreemptive, bool *lastMsgOS)
+   {
+    // initialize function/variables
+    traceRecordType record = { 0 };
+    int logLevel = LOG_LEVEL_OP_CODE, eventClass = LOG_EVENT_CPU;
+    
+    // cpu op codes take the fast path
+    if (compareString(opWkgPtr->command, "cpu") == STR_EQ)
+      {
+       return logCpuOp(prcId, logHeadPtr, timerPtr, cfgPtr, cmdType,
+                                       displayString, isPreemptive, lastMsgOS);
+      }
+
+    // check for device op code
+    if (compareString(opWkgPtr->command, "dev") == STR_EQ)
+      {
+       eventClass = LOG_EVENT_IO;
+       record.detail = TRACE_OP_DEV;
+      }
+    // otherwise assume memory op code, which is memory detail
+    else
+      {
+       logLevel = LOG_LEVEL_MEMORY_CODE;
+       eventClass = LOG_EVENT_MEMORY;
+       record.detail = compareString(opWkgPtr->strArg1, "allocate") == STR_EQ
+                                         ? TRACE_OP_ALLOCATE : TRACE_OP_ACCESS;
+      }
+
+    // drop filtered events before any formatting
+    if (!logEventShown(cfgPtr, logLevel, eventClass, prcId))
+      {
+       return logHeadPtr;
+      }
+    
+    // get current runtime of the simulation
+    record.timeNSec = accessTimer(timerPtr, LAP_TIMER);
+
+    record.kind = TRACE_PROCESS_OP;
+    record.processId = prcId;
+    record.code = cmdType;
+    record.isPreemptive = isPreemptive;
+    record.device = DEVICE_COUNT;
+
+    // record the device operation, or the memory base and offset
+    if (record.detail == TRACE_OP_DEV)
+      {
+       record.device = getDeviceCode(opWkgPtr->strArg1);
+       record.isOutput = compareString(opWkgPtr->inOutArg, "out") == STR_EQ;
+      }
+    else if (record.detail != TRACE_OP_CPU)
+      {
+       record.arg = opWkgPtr->intArg2;
+       record.value = opWkgPtr->intArg3;
+      }
+    
+    // call the record logger to handle output
+    return logTraceRecord(logHeadPtr, &record, cfgPtr->logToCode,
+                                                     displayString, lastMsgOS);
+   }
+
+// opens the log file, writes its header and starts the writer thread,
+// returns NULL when output is not logged to a file
+logFileType *openLogFile(ConfigDataType *cfgPtr, char *displayString)
+   {
+    // initialize function/variables
+    FILE *logFile;
+    logFileType *logPtr;
+    traceHeaderType header;
+    int logToCode = cfgPtr->logToCode;
+    
+    // check for log file output code
+    if (logToCode == LOGTO_MONITOR_CODE)
+      {
+       return NULL;
+      }
+
+    // point file pointer to opened/created logfile
+    logFile = fopen(cfgPtr->logToFileName, WRITE);
+       
+    // check if file open failed
+    if (logFile == NULL)
+      {
+       return NULL;
+      }
+
+    logPtr = (logFileType *)malloc(sizeof(logFileType));
+
+    // the header goes out before the simulation starts, trace files 
+    // store it for the formatter to print
+    fillTraceHeader(&header, cfgPtr);
+
+    if (logToCode == LOGTO_TRACE_CODE)
+      {
+       fwrite(&header, sizeof(traceHeaderType), 1, logFile);
+      }
+    else if (logToCode == LOGTO_CHROME_CODE)
+      {
+       writeChromeHeader(logFile, &logPtr->chromeState);
+      }
+    else
+      {
+       writeLogHeader(logFile, &header, displayString);
+      }
+
+    fflush(logFile);
+
+    logPtr->tailChunk = NULL;
+
+    logPtr->queueHead = NULL;
+
+    logPtr->queueTail = NULL;
+
+    logPtr->queuedChunks = 0;
+
+    logPtr->freeChunks = NULL;
+
+    logPtr->filePtr = logFile;
+
+    logPtr->shutdown = false;
+
+    logPtr->logToCode = logToCode;
+
+    logPtr->fileLastMsgOS = false;
+
+    logPtr->traceLastUSec = 0;
+
+    pthread_mutex_init(&logPtr->logLock, NULL);
+
+    pthread_cond_init(&logPtr->chunkSignal, NULL);
+
+    pthread_cond_init(&logPtr->spaceSignal, NULL);
+
+    pthread_create(&logPtr->writerThread, NULL, writeLogChunks, (void *)logPtr);
+
+    return logPtr;
+   }
+
+// queues the tail chunk for the writer, waiting while the queue is full
+void submitLogChunk(logFileType *logPtr)
+   {
+    // initialize function/variables
+    logChunkType *chunkPtr = logPtr->tailChunk;
+
+    // check for text to hand over
+    if (chunkPtr == NULL || chunkPtr->used == 0)
+      {
+       return;
+      }
+
+    pthread_mutex_lock(&logPtr->logLock);
+
+    // wait for the writer to make room, this keeps memory bounded
+    while (logPtr->queuedChunks >= LOG_QUEUE_CHUNKS)
+      {
+       pthread_cond_wait(&logPtr->spaceSignal, &logPtr->logLock);
+      }
+
+    // add the chunk to the end of the queue
+    if (logPtr->queueTail == NULL)
+      {
+       logPtr->queueHead = chunkPtr;
+      }
+    else
+      {
+       logPtr->queueTail->nextChunk = chunkPtr;
+      }
+
+    logPtr->queueTail = chunkPtr;
+
+    logPtr->queuedChunks++;
+
+    pthread_cond_signal(&logPtr->chunkSignal);
+
+    pthread_mutex_unlock(&logPtr->logLock);
+
+    logPtr->tailChunk = NULL;
+   }
+
+// function for the log writer p_thread, writes queued chunks in order
+// until the log is closed
+void *writeLogChunks(void *args)
+   {
+    // initialize function/variables
+    logFileType *logPtr = (logFileType *) args;
+    logChunkType *chunkPtr;
+
+    pthread_mutex_lock(&logPtr->logLock);
+
+    // loop until the queue is empty after the log is closed
+    while (logPtr->queueHead != NULL || !logPtr->shutdown)
+      {
+       // wait for a chunk to write
+       if (logPtr->queueHead == NULL)
+         {
+          pthread_cond_wait(&logPtr->chunkSignal, &logPtr->logLock);
+         }
+
+       else
+         {
+          // take the oldest chunk
+          chunkPtr = logPtr->queueHead;
+
+          logPtr->queueHead = chunkPtr->nextChunk;
+
+          if (logPtr->queueHead == NULL)
+            {
+             logPtr->queueTail = NULL;
+            }
+
+          // write it outside the lock so the simulation keeps logging,
+          // flushing so the file holds everything written so far
+          pthread_mutex_unlock(&logPtr->logLock);
+
+          writeLogRecords(logPtr, chunkPtr);
+
+          fflush(logPtr->filePtr);
+
+          pthread_mutex_lock(&logPtr->logLock);
+
+          // keep the chunk for reuse
+          chunkPtr->nextChunk = logPtr->freeChunks;
+
+          logPtr->freeChunks = chunkPtr;
+
+          // make room in the queue
+          logPtr->queuedChunks--;
+
+          pthread_cond_signal(&logPtr->spaceSignal);
+         }
+      }
+
+    pthread_mutex_unlock(&logPtr->logLock);
+
+    // exit the p_thread when finished
+    return NULL;
+   }
+
+// formats the records of a chunk for the log file, trace files store
+// the records packed
+void writeLogRecords(logFileType *logPtr, const logChunkType *chunkPtr)
+   {
+    // initialize function/variables
+    char displayString[CHROME_EVENT_LEN];
+    int index;
+
+    // loop across the records, formatting each one
+    for (index = 0; index < chunkPtr->used; index++)
+      {
+       // check for binary trace output
+       if (logPtr->logToCode == LOGTO_TRACE_CODE)
+         {
+          writeTraceRecord(logPtr->filePtr, &chunkPtr->records[index],
+                                                      &logPtr->traceLastUSec);
+
+          continue;
+         }
+
+       // check for trace viewer output
+       if (logPtr->logToCode == LOGTO_CHROME_CODE)
+         {
+          formatChromeRecord(&chunkPtr->records[index], displayString, 
+                                                          &logPtr->chromeState);
+         }
+
+       // otherwise format the text log line
+       else
+         {
+          formatTraceRecord(&chunkPtr->records[index], displayString,
+                                                       &logPtr->fileLastMsgOS);
+         }
+
+       fputs(displayString, logPtr->filePtr);
+      }
+   }
+
+//////////////////////////////
+//     MEMORY FUNCTIONS     //
+//////////////////////////////
+
+// function for adding a new simulated memory allocation, the block goes
+// on the end of the allocation order and into the address tree, the 
+// shared one or the process one when the simulator places memory
+memoryMapType *addMemoryNode(memoryMapType *memMapPtr, processType *prcPtr,
+                    long long memBase, long long memOffset, long long physBase)
+   {
+    // initialize function/variables
+    memoryType *memPtr = (memoryType *)malloc(sizeof(memoryType));
+       
+    // assign relevant info from parameters
+    memPtr->processId = prcPtr->processId;
+
+    memPtr->memBase = memBase;
+
+    memPtr->memOffset = memOffset - MEM_SHIFT;
+
+    memPtr->physBase = physBase;
+       
+    // point the next node pointer to NULL
+    memPtr->nextBlock = NULL;
+
+    memPtr->lowerBlock = NULL;
+
+    memPtr->higherBlock = NULL;
+
+    memPtr->height = 0;
+
+    // add the block to the blocks of its process
+    memPtr->nextProcessBlock = prcPtr->memBlocks;
+
+    prcPtr->memBlocks = memPtr;
+
+    // add the block to the end of the allocation order
+    memPtr->prevBlock = memMapPtr->tailBlock;
+
+    if (memMapPtr->tailBlock == NULL)
+      {
+       memMapPtr->headBlock = memPtr;
+      }
+    else
+      {
+       memMapPtr->tailBlock->nextBlock = memPtr;
+      }
+
+    memMapPtr->tailBlock = memPtr;
+
+    // index blocks holding memory, empty blocks can never conflict or
+    // be accessed and stay out of the tree with a height of zero
+    if (memPtr->memOffset >= 0
+                           && memMapPtr->placementCode == MEM_PLACE_EXACT_CODE)
+      {
+       memMapPtr->rootBlock = insertBlock(memMapPtr->rootBlock, memPtr);
+      }
+    else if (memPtr->memOffset >= 0)
+      {
+       prcPtr->memTree = insertBlock(prcPtr->memTree, memPtr);
+      }
+    
+    // return the memory map
+    return memMapPtr;
+   }
+
+// returns the height of a subtree, zero for an empty one
+int blockHeight(memoryType *blockPtr)
+   {
+    return blockPtr == NULL ? 0 : blockPtr->height;
+   }
+
+// restores the balance of a subtree whose children differ in height by
+// at most two, returns the new subtree root
+memoryType *balanceBlock(memoryType *blockPtr)
+   {
+    // initialize function/variables
+    int balance = blockHeight(blockPtr->lowerBlock) 
+                                       - blockHeight(blockPtr->higherBlock);
+
+    // check for a lower side that is too tall
+    if (balance > 1)
+      {
+       // straighten a bend toward the higher side first
+       if (blockHeight(blockPtr->lowerBlock->lowerBlock) 
+                         < blockHeight(blockPtr->lowerBlock->higherBlock))
+         {
+          blockPtr->lowerBlock = rotateBlock(blockPtr->lowerBlock, true);
+         }
+
+       return rotateBlock(blockPtr, false);
+      }
+
+    // check for a higher side that is too tall
+    if (balance < -1)
+      {
+       // straighten a bend toward the lower side first
+       if (blockHeight(blockPtr->higherBlock->higherBlock) 
+                         < blockHeight(blockPtr->higherBlock->lowerBlock))
+         {
+          blockPtr->higherBlock = rotateBlock(blockPtr->higherBlock, false);
+         }
+
+       return rotateBlock(blockPtr, true);
+      }
+
+    updateBlockHeight(blockPtr);
+
+    return blockPtr;
+   }
+
+// restores the balance of a free memory subtree in one of its orders,
+// returns the new subtree root
+freeBlockType *balanceFreeBlock(freeBlockType *blockPtr, int order)
+   {
+    // initialize function/variables
+    freeBlockType *lowerPtr = blockPtr->lowerBlock[order], 
+                  *higherPtr = blockPtr->higherBlock[order];
+    int balance = freeBlockHeight(lowerPtr, order)
+                                          - freeBlockHeight(higherPtr, order);
+
+    // check for a lower side that is too tall
+    if (balance > 1)
+      {
+       // straighten a bend toward the higher side first
+       if (freeBlockHeight(lowerPtr->lowerBlock[order], order) 
+                         < freeBlockHeight(lowerPtr->higherBlock[order], order))
+         {
+          blockPtr->lowerBlock[order] = rotateFreeBlock(lowerPtr, true, order);
+         }
+
+       return rotateFreeBlock(blockPtr, false, order);
+      }
+
+    // check for a higher side that is too tall
+    if (balance < -1)
+      {
+       // straighten a bend toward the lower side first
+       if (freeBlockHeight(higherPtr->higherBlock[order], order) 
+                         < freeBlockHeight(higherPtr->lowerBlock[order], order))
+         {
+          blockPtr->higherBlock[order]
+                                    = rotateFreeBlock(higherPtr, false, order);
+         }
+
+       return rotateFreeBlock(blockPtr, true, order);
+      }
+
+    updateFreeBlock(blockPtr, order);
+
+    return blockPtr;
+   }
+
+// returns the order of the smallest buddy block that holds the given 
+// size, which may be past the largest order memory has
+int buddyOrder(memoryMapType *memMapPtr, long long size)
+   {
+    // initialize function/variables
+    long long blockSize = 1LL << memMapPtr->buddyMinShift;
+    int order = 0;
+
+    // double the block until the size fits
+    while (blockSize < size)
+      {
+       blockSize = blockSize * 2;
+
+       order++;
+      }
+
+    return order;
+   }
+
+// frees the buddy system free bitmaps
+memoryMapType *clearBuddyOrders(memoryMapType *memMapPtr)
+   {
+    // initialize function/variables
+    int order, level;
+
+    for (order = 0; order < memMapPtr->buddyOrderCount; order++)
+      {
+       for (level = 0; level < memMapPtr->buddyOrders[order].levelCount;
+                                                                       level++)
+         {
+          free(memMapPtr->buddyOrders[order].levelBits[level]);
+         }
+      }
+
+    free(memMapPtr->buddyOrders);
+
+    memMapPtr->buddyOrders = NULL;
+
+    memMapPtr->buddyOrderCount = 0;
+
+    return memMapPtr;
+   }
+
+// frees every extent of free memory, returns NULL
+freeBlockType *clearFreeBlocks(freeBlockType *rootPtr)
+   {
+    // every extent is in the base ordered tree
+    if (rootPtr != NULL)
+      {
+       clearFreeBlocks(rootPtr->lowerBlock[FREE_BY_BASE]);
+
+       clearFreeBlocks(rootPtr->higherBlock[FREE_BY_BASE]);
+
+       free(rootPtr);
+      }
+
+    return NULL;
+   }
+
+// function for clearing the entire simulated memory
+memoryMapType *clearMemory(memoryMapType *memMapPtr)
+   {
+    // initialize function/variables
+    memoryType *memPtr, *temp;
+
+    // check for memory that was never initialized
+    if (memMapPtr == NULL)
+      {
+       return NULL;
+      }
+
+    memPtr = memMapPtr->headBlock;
+    
+    // iterate through the allocation order, every block is listed there
+    while (memPtr != NULL)
+      {
+       // point temp pointer to current pointer
+       temp = memPtr;
+
+       // point current pointer to next node pointer
+       memPtr = memPtr->nextBlock;
+
+       // free the temp pointer
+       free(temp);
+      }
+
+    memMapPtr = clearBuddyOrders(memMapPtr);
+
+    clearFreeBlocks(memMapPtr->freeRoot[FREE_BY_BASE]);
+
+    free(memMapPtr);
+    
+    // return NULL
+    return NULL;
+   }
+
+// displays the free buddy blocks in address order, each step takes the 
+// nearest free block past the last one shown from any order
+void displayBuddyBlocks(memoryMapType *memMapPtr)
+   {
+    // initialize function/variables
+    long long cursor = 0, nearest, index, blockSize;
+    int order, nearestOrder = 0;
+
+    do
+      {
+       nearest = MEM_NOT_PLACED;
+
+       // find the first free block of each order starting at or after 
+       // the cursor, in smallest blocks
+       for (order = 0; order < memMapPtr->buddyOrderCount; order++)
+         {
+          index = findFreeBuddy(&memMapPtr->buddyOrders[order], 0, 
+                                 (cursor + (1LL << order) - 1) >> order);
+
+          if (index != MEM_NOT_PLACED && (nearest == MEM_NOT_PLACED
+                                                || (index << order) < nearest))
+            {
+             nearest = index << order;
+
+             nearestOrder = order;
+            }
+         }
+
+       if (nearest != MEM_NOT_PLACED)
+         {
+          blockSize = 1LL << (nearestOrder + memMapPtr->buddyMinShift);
+
+          printf("%lld [ Open, P#: x, 0-0 ] %lld\n",
+                                           nearest << memMapPtr->buddyMinShift,
+                (nearest << memMapPtr->buddyMinShift) + blockSize - MEM_SHIFT);
+
+          cursor = nearest + (1LL << nearestOrder);
+         }
+      }
+    while (nearest != MEM_NOT_PLACED);
+   }
+
+// displays the free memory extents in address order
+void displayFreeBlocks(freeBlockType *rootPtr)
+   {
+    if (rootPtr != NULL)
+      {
+       displayFreeBlocks(rootPtr->lowerBlock[FREE_BY_BASE]);
+
+       printf("%lld [ Open, P#: x, 0-0 ] %lld\n", rootPtr->base,
+                                    rootPtr->base + rootPtr->size - MEM_SHIFT);
+
+       displayFreeBlocks(rootPtr->higherBlock[FREE_BY_BASE]);
+      }
+   }
+
+// function for identifying valid memory access request
+bool findAccess(memoryType *rootPtr, int prcId, long long accessBase,
+                                                        long long accessOffset)
+   {
+    // initialize function/variables
+    long long memSize, accessSize = accessBase + accessOffset;
+
+    // blocks do not overlap, so only the block with the closest base at
+    // or below the request can hold it
+    memoryType *memPtr = findBlockAtOrBelow(rootPtr, accessBase);
+
+    // check for no block at or below the request
+    if (memPtr == NULL)
+      {
+       return false;
+      }
+
+    // calculate the size of memory access request
+    memSize = memPtr->memBase + memPtr->memOffset;
+
+    // check if the request base is compatible, and the request size is
+    // compatible and correct process allocation
+    return accessBase < memSize
+             && (accessSize > accessBase && accessSize <= memSize) 
+                                                && prcId == memPtr->processId;
+   }
+
+// finds the smallest free extent that can hold the size, the lowest
+// based of those that are the same size
+freeBlockType *findBestFit(freeBlockType *rootPtr, long long size)
+   {
+    // initialize function/variables
+    freeBlockType *foundPtr = NULL;
+
+    // walk down the size ordered tree, remembering the last fit
+    while (rootPtr != NULL)
+      {
+       if (rootPtr->size >= size)
+         {
+          foundPtr = rootPtr;
+
+          rootPtr = rootPtr->lowerBlock[FREE_BY_SIZE];
+         }
+       else
+         {
+          rootPtr = rootPtr->higherBlock[FREE_BY_SIZE];
+         }
+      }
+
+    return foundPtr;
+   }
+
+// finds the block with the highest base at or below the address
+memoryType *findBlockAtOrBelow(memoryType *rootPtr, long long address)
+   {
+    // initialize function/variables
+    memoryType *foundPtr = NULL;
+
+    // walk down the tree, remembering the last block at or below
+    while (rootPtr != NULL)
+      {
+       if (rootPtr->memBase <= address)
+         {
+          foundPtr = rootPtr;
+
+          rootPtr = rootPtr->higherBlock;
+         }
+       else
+         {
+          rootPtr = rootPtr->lowerBlock;
+         }
+      }
+
+    return foundPtr;
+   }
+
+// function for identifying valid memory allocation request
+bool findConflict(long long desiredBase, long long desiredOffset, 
+                                   long long memAvailable, memoryType *rootPtr)
+   { 
+    // initialize function/variables
+    long long lowAddress = desiredBase, highAddress = desiredBase,
+        desiredSize = desiredBase + desiredOffset - MEM_SHIFT;
+    memoryType *memPtr;
+    
+    // check for allocation request outside of sim memory boundaries
+    if (desiredBase >= memAvailable || desiredSize > memAvailable)
+      {
+       // return conflict found
+       return true;
+      }      
+
+    // find the addresses the request covers, an empty request checks its
+    // base and the address before it
+    if (desiredSize < lowAddress)
+      {
+       lowAddress = desiredSize;
+      }
+    else
+      {
+       highAddress = desiredSize;
+      }
+    
+    // blocks do not overlap, so only the block with the closest base at
+    // or below the end of the request can reach into it
+    memPtr = findBlockAtOrBelow(rootPtr, highAddress);
+
+    // notify simulation of an invalid allocation request when that
+    // block ends inside or past the start of the request
+    return memPtr != NULL && memPtr->memBase + memPtr->memOffset >= lowAddress;
+   }
+
+// finds the lowest based free extent at or above the given base that 
+// can hold the size, skipping subtrees with no extent large enough
+freeBlockType *findFirstFit(freeBlockType *rootPtr, long long size,
+                                                            long long fromBase)
+   {
+    // initialize function/variables
+    freeBlockType *foundPtr;
+
+    // check for no extent large enough below here
+    if (rootPtr == NULL || rootPtr->largestSize < size)
+      {
+       return NULL;
+      }
+
+    // extents at or above the start are searched lowest first
+    if (rootPtr->base >= fromBase)
+      {
+       foundPtr = findFirstFit(rootPtr->lowerBlock[FREE_BY_BASE],
+                                                               size, fromBase);
+
+       if (foundPtr != NULL)
+         {
+          return foundPtr;
+         }
+
+       if (rootPtr->size >= size)
+         {
+          return rootPtr;
+         }
+      }
+
+    return findFirstFit(rootPtr->higherBlock[FREE_BY_BASE], size, fromBase);
+   }
+
+// finds the free extent with the highest base at or below the address
+freeBlockType *findFreeAtOrBelow(freeBlockType *rootPtr, long long address)
+   {
+    // initialize function/variables
+    freeBlockType *foundPtr = NULL;
+
+    // walk down the base ordered tree, remembering the last extent at or
+    // below
+    while (rootPtr != NULL)
+      {
+       if (rootPtr->base <= address)
+         {
+          foundPtr = rootPtr;
+
+          rootPtr = rootPtr->higherBlock[FREE_BY_BASE];
+         }
+       else
+         {
+          rootPtr = rootPtr->lowerBlock[FREE_BY_BASE];
+         }
+      }
+
+    return foundPtr;
+   }
+
+// returns the index of the lowest free buddy block at or after the 
+// given index, searching from the given bitmap level, or MEM_NOT_PLACED
+// when there is none
+long long findFreeBuddy(buddyBitmapType *bitmapPtr, int level,
+                                                           long long fromIndex)
+   {
+    // initialize function/variables
+    long long word = fromIndex / BUDDY_WORD_BITS;
+    unsigned long long bits;
+
+    // check for searching past the last word of the level
+    if (level >= bitmapPtr->levelCount || word >= bitmapPtr->levelWords[level])
+      {
+       return MEM_NOT_PLACED;
+      }
+
+    bits = bitmapPtr->levelBits[level][word] 
+                              & (~0ULL << (fromIndex % BUDDY_WORD_BITS));
+
+    // the level above finds the next word holding a free block
+    if (bits == 0)
+      {
+       word = findFreeBuddy(bitmapPtr, level + 1, word + 1);
+
+       if (word == MEM_NOT_PLACED)
+         {
+          return MEM_NOT_PLACED;
+         }
+
+       bits = bitmapPtr->levelBits[level][word];
+      }
+
+    return word * BUDDY_WORD_BITS + __builtin_ctzll(bits);
+   }
+
+// checks the first extent comes before the second in the given order,
+// extents are unique in both orders
+bool freeBlockBefore(freeBlockType *firstPtr, freeBlockType *secondPtr,
+                                                                     int order)
+   {
+    if (order == FREE_BY_SIZE && firstPtr->size != secondPtr->size)
+      {
+       return firstPtr->size < secondPtr->size;
+      }
+
+    return firstPtr->base < secondPtr->base;
+   }
+
+// returns the height of a free memory subtree, zero for an empty one
+int freeBlockHeight(freeBlockType *blockPtr, int order)
+   {
+    return blockPtr == NULL ? 0 : blockPtr->height[order];
+   }
+
+// function for handling all memory related actions
+memoryMapType *handleMemory(processType *prcCurrent, ConfigDataType *configPtr,
+                                        memoryMapType *memMapPtr, int *memCode)
+   {
+    // initialize function/variables
+    memoryType *rootPtr = NULL;
+    long long physBase;
+    int order;
+
+    // requests are checked against the shared addresses, or against the
+    // process addresses when the simulator places memory
+    if (prcCurrent != NULL && memMapPtr != NULL)
+      {
+       rootPtr = memMapPtr->placementCode == MEM_PLACE_EXACT_CODE
+                                 ? memMapPtr->rootBlock : prcCurrent->memTree;
+      }
+
+    // determine memory action type
+    switch (*memCode)
+      {
+       // handle initialize request, memory starts with no blocks, and 
+       // all of it free when the simulator places memory
+       case INITIALIZE:
+          memMapPtr = (memoryMapType *)malloc(sizeof(memoryMapType));
+
+          memMapPtr->headBlock = NULL;
+
+          memMapPtr->tailBlock = NULL;
+
+          memMapPtr->rootBlock = NULL;
+
+          memMapPtr->placementCode = configPtr->memPlacementCode;
+
+          memMapPtr->nextFitBase = 0;
+
+          for (order = 0; order < FREE_TREE_COUNT; order++)
+            {
+             memMapPtr->freeRoot[order] = NULL;
+            }
+
+          memMapPtr->buddyOrders = NULL;
+
+          memMapPtr->buddyOrderCount = 0;
+
+          memMapPtr->lastWaste = 0;
+
+          memMapPtr->totalWaste = 0;
+
+          memMapPtr->placedCount = 0;
+
+          if (memMapPtr->placementCode == MEM_PLACE_BUDDY_CODE)
+            {
+             memMapPtr = initBuddyOrders(memMapPtr, configPtr->memAvailable);
+            }
+          else if (memMapPtr->placementCode != MEM_PLACE_EXACT_CODE)
+            {
+             memMapPtr = releaseMemory(memMapPtr, 0, configPtr->memAvailable);
+            }
+       break;
+
+       // handle allocation request
+       case ALLOCATE:
+          physBase = prcCurrent->opHeadPtr->intArg2;
+
+          *memCode = ALLOCATE_FAILIURE;
+
+          if (!findConflict(prcCurrent->opHeadPtr->intArg2, 
+                                    prcCurrent->opHeadPtr->intArg3,
+                                          configPtr->memAvailable, rootPtr))
+            {
+             // let the placement policy pick where the memory goes
+             if (memMapPtr->placementCode != MEM_PLACE_EXACT_CODE
+                                          && prcCurrent->opHeadPtr->intArg3 > 0)
+               {
+                physBase = placeMemory(memMapPtr,
+                                               prcCurrent->opHeadPtr->intArg3);
+               }
+
+             // store allocation pcb struct as valid request
+             if (physBase != MEM_NOT_PLACED)
+               {
+                memMapPtr = addMemoryNode(memMapPtr, prcCurrent,
+                                                prcCurrent->opHeadPtr->intArg2,
+                                                prcCurrent->opHeadPtr->intArg3,
+                                                                     physBase);
+
+                // set memory code to ALLOCATE_SUCCESS
+                *memCode = ALLOCATE_SUCCESS;
+               }
+            }
+       break;
+       
+       // handle access request
+       case ACCESS:
+          // check if pcb node was allocated
+          if (findAccess(rootPtr, prcCurrent->processId,
+                                             prcCurrent->opHeadPtr->intArg2,
+                                                prcCurrent->opHeadPtr->intArg3))
+            {
+             *memCode = ACCESS_SUCCESS;
+            }
+          // otherwise
+          else
+            {
+             *memCode = ACCESS_FAILIURE;
+            }
+       break;
+       
+       // handle deallocation request
+       case DEALLOCATE:
+          memMapPtr = removeBlock(memMapPtr, prcCurrent);
+
+       break;
+       
+       // handle deinitialize request
+       case DEINITIALIZE:
+          memMapPtr = clearMemory(memMapPtr);
+       break;
+      }
+
+    // display output
+    if (configPtr->memDisplay && configPtr->logToCode != LOGTO_FILE_CODE
+           && logEventShown(configPtr, LOG_LEVEL_MEMORY_CODE, LOG_EVENT_MEMORY,
+                               prcCurrent != NULL ? prcCurrent->processId : 0))
+      {
+       memoryStringEngine(memMapPtr, prcCurrent, configPtr->memAvailable, 
+                                                                     memCode);
+      }
+   
+    // return memory map pointer
+    return memMapPtr;
+   }
+
+// sets up the buddy system free bitmaps with all of memory free, the
+// smallest block is sized so memory holds at most BUDDY_MAX_BLOCKS of
+// them, and memory past the last whole smallest block is not used
+memoryMapType *initBuddyOrders(memoryMapType *memMapPtr, long long memAvailable)
+   {
+    // initialize function/variables
+    buddyBitmapType *bitmapPtr;
+    long long blockUnits, words, base = 0;
+    int order;
+
+    memMapPtr->buddyMinShift = 0;
+
+    while ((BUDDY_MAX_BLOCKS << memMapPtr->buddyMinShift) < memAvailable)
+      {
+       memMapPtr->buddyMinShift++;
+      }
+
+    blockUnits = memAvailable >> memMapPtr->buddyMinShift;
+
+    // there is an order for each block size up to the size of memory
+    memMapPtr->buddyOrderCount = 1;
+
+    while ((1LL << memMapPtr->buddyOrderCount) <= blockUnits)
+      {
+       memMapPtr->buddyOrderCount++;
+      }
+
+    memMapPtr->buddyOrders
+               = (buddyBitmapType *)malloc(memMapPtr->buddyOrderCount
+                                                    * sizeof(buddyBitmapType));
+
+    // give each order its bitmap levels, up to a single top word
+    for (order = 0; order < memMapPtr->buddyOrderCount; order++)
+      {
+       bitmapPtr = &memMapPtr->buddyOrders[order];
+
+       bitmapPtr->blockCount = blockUnits >> order;
+
+       bitmapPtr->levelCount = 0;
+
+       words = bitmapPtr->blockCount;
+
+       do
+         {
+          words = (words + BUDDY_WORD_BITS - 1) / BUDDY_WORD_BITS;
+
+          bitmapPtr->levelBits[bitmapPtr->levelCount]
+             = (unsigned long long *)calloc(words, sizeof(unsigned long long));
+
+          bitmapPtr->levelWords[bitmapPtr->levelCount] = words;
+
+          bitmapPtr->levelCount++;
+         }
+       while (words > 1);
+      }
+
+    // free memory as the largest aligned blocks that fit, largest first
+    for (order = memMapPtr->buddyOrderCount - 1; order >= 0; order--)
+      {
+       if (base + (1LL << order) <= blockUnits)
+         {
+          setBuddyBit(&memMapPtr->buddyOrders[order], base >> order, true);
+
+          base = base + (1LL << order);
+         }
+      }
+
+    return memMapPtr;
+   }
+
+// adds a block to the address tree, returns the new tree root
+memoryType *insertBlock(memoryType *rootPtr, memoryType *blockPtr)
+   {
+    // check for the empty place the block belongs in
+    if (rootPtr == NULL)
+      {
+       blockPtr->height = 1;
+
+       return blockPtr;
+      }
+
+    // add the block to the side its base belongs on
+    if (blockPtr->memBase < rootPtr->memBase)
+      {
+       rootPtr->lowerBlock = insertBlock(rootPtr->lowerBlock, blockPtr);
+      }
+    else
+      {
+       rootPtr->higherBlock = insertBlock(rootPtr->higherBlock, blockPtr);
+      }
+
+    return balanceBlock(rootPtr);
+   }
+
+// adds a free extent to one of the free memory trees, returns the new
+// tree root
+freeBlockType *insertFreeBlock(freeBlockType *rootPtr, freeBlockType *blockPtr,
+                                                                     int order)
+   {
+    // check for the empty place the extent belongs in
+    if (rootPtr == NULL)
+      {
+       blockPtr->lowerBlock[order] = NULL;
+
+       blockPtr->higherBlock[order] = NULL;
+
+       updateFreeBlock(blockPtr, order);
+
+       return blockPtr;
+      }
+
+    // add the extent to the side it belongs on
+    if (freeBlockBefore(blockPtr, rootPtr, order))
+      {
+       rootPtr->lowerBlock[order] = insertFreeBlock(rootPtr->lowerBlock[order],
+                                                              blockPtr, order);
+      }
+    else
+      {
+       rootPtr->higherBlock[order]
+               = insertFreeBlock(rootPtr->higherBlock[order], blockPtr, order);
+      }
+
+    return balanceFreeBlock(rootPtr, order);
+   }
+
+// adds a free extent to both free memory trees
+memoryMapType *insertFreeExtent(memoryMapType *memMapPtr,
+                                                       freeBlockType *blockPtr)
+   {
+    // initialize function/variables
+    int order;
+
+    for (order = 0; order < FREE_TREE_COUNT; order++)
+      {
+       memMapPtr->freeRoot[order] = insertFreeBlock(memMapPtr->freeRoot[order],
+                                                              blockPtr, order);
+      }
+
+    return memMapPtr;
+   }
+
+// function for generating memory display
+void memoryStringEngine(memoryMapType *memMapPtr, processType *prcPtr,
+                                           long long totalMemory, int *memCode)
+   {
+    long long memDispBase = 0;
+    memoryType *memHeadPtr = memMapPtr != NULL ? memMapPtr->headBlock : NULL;
+
+    printf("%s", MEM_LINE);
+    switch (*memCode)
+      {
+       case INITIALIZE:
+       printf("After memory initialization\n");
+       break;
+       
+       case ALLOCATE_SUCCESS:
+       printf("After allocate success\n");
+       break;
+
+       case ALLOCATE_FAILIURE:
+       printf("After allocate failiure\n");
+       break;
+
+       case ACCESS_SUCCESS:
+       printf("After access success\n");
+       break;
+
+       case ACCESS_FAILIURE:
+       printf("After access failiure\n");
+       break;
+
+       case DEALLOCATE:
+       printf("After clear process %d success\n", prcPtr->processId);
+       break;
+
+       case DEINITIALIZE:
+       printf("After clear all process success\nNo memory configured\n");
+       break;
+      }
+
+    while(memHeadPtr != NULL)
+      {
+       // placed blocks show where they were placed
+       if (memMapPtr->placementCode != MEM_PLACE_EXACT_CODE)
+         {
+          memDispBase = memHeadPtr->physBase;
+         }
+
+       printf("%lld [ Used, P# %d, %lld-%lld] %lld\n", memDispBase, 
+                           memHeadPtr->processId, memHeadPtr->memBase, 
+                              memHeadPtr->memBase + memHeadPtr->memOffset, 
+                                          memDispBase + memHeadPtr->memOffset);
+
+       memDispBase = memDispBase + memHeadPtr->memOffset + MEM_SHIFT;
+       memHeadPtr = memHeadPtr->nextBlock;
+      }    
+
+    // show the free blocks or extents when the simulator places memory
+    if (*memCode != DEINITIALIZE 
+                         && memMapPtr->placementCode == MEM_PLACE_BUDDY_CODE)
+      {
+       displayBuddyBlocks(memMapPtr);
+      }
+    else if (*memCode != DEINITIALIZE 
+                         && memMapPtr->placementCode != MEM_PLACE_EXACT_CODE)
+      {
+       displayFreeBlocks(memMapPtr->freeRoot[FREE_BY_BASE]);
+      }
+    else if (*memCode != DEINITIALIZE)
+      {
+       printf("%lld [ Open, P#: x, 0-0 ] %lld\n", memDispBase, 
+                                                      totalMemory - MEM_SHIFT);
+      }
+    
+    printf("%s", MEM_LINE);
+   }
+
+
+// places an allocation in the lowest free block of the smallest buddy
+// size that has one, splitting it down to the smallest size that holds
+// the allocation, returns its base or MEM_NOT_PLACED when no free block
+// can hold it
+long long placeBuddy(memoryMapType *memMapPtr, long long size)
+   {
+    // initialize function/variables
+    int order = buddyOrder(memMapPtr, size), fromOrder = order;
+    long long index = MEM_NOT_PLACED, blockSize;
+
+    // find the smallest size with a free block
+    while (index == MEM_NOT_PLACED && fromOrder < memMapPtr->buddyOrderCount)
+      {
+       index = findFreeBuddy(&memMapPtr->buddyOrders[fromOrder], 0, 0);
+
+       if (index == MEM_NOT_PLACED)
+         {
+          fromOrder++;
+         }
+      }
+
+    // check for no block large enough
+    if (index == MEM_NOT_PLACED)
+      {
+       return MEM_NOT_PLACED;
+      }
+
+    // take the block, splitting off its upper halves as free buddies
+    setBuddyBit(&memMapPtr->buddyOrders[fromOrder], index, false);
+
+    while (fromOrder > order)
+      {
+       fromOrder--;
+
+       index = index * 2;
+
+       setBuddyBit(&memMapPtr->buddyOrders[fromOrder], index + 1, true);
+      }
+
+    // the rest of the block is internal fragmentation
+    blockSize = 1LL << (order + memMapPtr->buddyMinShift);
+
+    memMapPtr->lastWaste = blockSize - size;
+
+    memMapPtr->totalWaste += memMapPtr->lastWaste;
+
+    memMapPtr->placedCount++;
+
+    return index * blockSize;
+   }
+
+// places an allocation of the given size with the configured policy,
+// returns its base or MEM_NOT_PLACED when no free extent can hold it
+long long placeMemory(memoryMapType *memMapPtr, long long size)
+   {
+    // initialize function/variables
+    freeBlockType *blockPtr, *lowPtr;
+    long long base = MEM_NOT_PLACED, end;
+
+    // the buddy system keeps its own free blocks
+    if (memMapPtr->placementCode == MEM_PLACE_BUDDY_CODE)
+      {
+       return placeBuddy(memMapPtr, size);
+      }
+
+    // find the extent the policy picks
+    switch (memMapPtr->placementCode)
+      {
+       case MEM_PLACE_BEST_FIT_CODE:
+          blockPtr = findBestFit(memMapPtr->freeRoot[FREE_BY_SIZE], size);
+          break;
+
+       // next fit carries on from the last placement, inside the extent
+       // holding it when the rest of that extent is large enough, 
+       // otherwise from the extents above it, wrapping around
+       case MEM_PLACE_NEXT_FIT_CODE:
+          blockPtr = findFreeAtOrBelow(memMapPtr->freeRoot[FREE_BY_BASE],
+                                                        memMapPtr->nextFitBase);
+
+          if (blockPtr != NULL && blockPtr->base + blockPtr->size
+                                            - memMapPtr->nextFitBase >= size)
+            {
+             base = memMapPtr->nextFitBase;
+            }
+          else
+            {
+             blockPtr = findFirstFit(memMapPtr->freeRoot[FREE_BY_BASE], size,
+                                                        memMapPtr->nextFitBase);
+            }
+
+          if (blockPtr == NULL)
+            {
+             blockPtr = findFirstFit(memMapPtr->freeRoot[FREE_BY_BASE],
+                                                                      size, 0);
+            }
+          break;
+
+       default:
+          blockPtr = findFirstFit(memMapPtr->freeRoot[FREE_BY_BASE], size, 0);
+          break;
+      }
+
+    // check for no extent large enough
+    if (blockPtr == NULL)
+      {
+       return MEM_NOT_PLACED;
+      }
+
+    // take the allocation from the start of the extent, unless next fit
+    // placed it inside, putting back the free memory either side
+    if (base == MEM_NOT_PLACED)
+      {
+       base = blockPtr->base;
+      }
+
+    end = blockPtr->base + blockPtr->size;
+
+    memMapPtr = removeFreeExtent(memMapPtr, blockPtr);
+
+    if (blockPtr->base < base)
+      {
+       lowPtr = (freeBlockType *)malloc(sizeof(freeBlockType));
+
+       lowPtr->base = blockPtr->base;
+
+       lowPtr->size = base - blockPtr->base;
+
+       memMapPtr = insertFreeExtent(memMapPtr, lowPtr);
+      }
+
+    if (end > base + size)
+      {
+       blockPtr->base = base + size;
+
+       blockPtr->size = end - blockPtr->base;
+
+       memMapPtr = insertFreeExtent(memMapPtr, blockPtr);
+      }
+    else
+      {
+       free(blockPtr);
+      }
+
+    memMapPtr->nextFitBase = base + size;
+
+    return base;
+   }
+
+// returns a buddy block to the free bitmaps, merging it with its buddy
+// for as long as the buddy is also free
+memoryMapType *releaseBuddy(memoryMapType *memMapPtr, long long base,
+                                                                long long size)
+   {
+    // initialize function/variables
+    int order = buddyOrder(memMapPtr, size);
+    long long index = base >> (order + memMapPtr->buddyMinShift);
+
+    while (order + 1 < memMapPtr->buddyOrderCount
+                && (index ^ 1) < memMapPtr->buddyOrders[order].blockCount
+                && testBuddyBit(&memMapPtr->buddyOrders[order], index ^ 1))
+      {
+       setBuddyBit(&memMapPtr->buddyOrders[order], index ^ 1, false);
+
+       index = index / 2;
+
+       order++;
+      }
+
+    setBuddyBit(&memMapPtr->buddyOrders[order], index, true);
+
+    return memMapPtr;
+   }
+
+// returns placed memory to the free trees, merging it with the free 
+// extents either side
+memoryMapType *releaseMemory(memoryMapType *memMapPtr, long long base,
+                                                                long long size)
+   {
+    // initialize function/variables
+    freeBlockType *rootPtr = memMapPtr->freeRoot[FREE_BY_BASE];
+    freeBlockType *prevPtr = NULL, *nextPtr = NULL, *blockPtr;
+
+    // find the free extents just below and above the released memory
+    while (rootPtr != NULL)
+      {
+       if (rootPtr->base < base)
+         {
+          prevPtr = rootPtr;
+
+          rootPtr = rootPtr->higherBlock[FREE_BY_BASE];
+         }
+       else
+         {
+          nextPtr = rootPtr;
+
+          rootPtr = rootPtr->lowerBlock[FREE_BY_BASE];
+         }
+      }
+
+    // merge an extent ending where the released memory starts
+    if (prevPtr != NULL && prevPtr->base + prevPtr->size == base)
+      {
+       memMapPtr = removeFreeExtent(memMapPtr, prevPtr);
+
+       base = prevPtr->base;
+
+       size += prevPtr->size;
+
+       free(prevPtr);
+      }
+
+    // merge an extent starting where the released memory ends
+    if (nextPtr != NULL && base + size == nextPtr->base)
+      {
+       memMapPtr = removeFreeExtent(memMapPtr, nextPtr);
+
+       size += nextPtr->size;
+
+       free(nextPtr);
+      }
+
+    blockPtr = (freeBlockType *)malloc(sizeof(freeBlockType));
+
+    blockPtr->base = base;
+
+    blockPtr->size = size;
+
+    return insertFreeExtent(memMapPtr, blockPtr);
+   }
+
+// removes every block of a process from the allocation order and the
+// address tree, visiting only the blocks the process owns
+memoryMapType *removeBlock(memoryMapType *memMapPtr, processType *prcPtr)
+   {
+    memoryType *temp;
+
+    while (prcPtr->memBlocks != NULL)
+      {
+       temp = prcPtr->memBlocks;
+       prcPtr->memBlocks = temp->nextProcessBlock;
+
+       // unlink the block from the allocation order
+       if (temp->prevBlock == NULL)
+         {
+          memMapPtr->headBlock = temp->nextBlock;
+         }
+       else
+         {
+          temp->prevBlock->nextBlock = temp->nextBlock;
+         }
+
+       if (temp->nextBlock == NULL)
+         {
+          memMapPtr->tailBlock = temp->prevBlock;
+         }
+       else
+         {
+          temp->nextBlock->prevBlock = temp->prevBlock;
+         }
+
+       // only blocks holding memory are in a tree, placed memory goes
+       // back to the free trees
+       if (temp->height > 0 && memMapPtr->placementCode == MEM_PLACE_EXACT_CODE)
+         {
+          memMapPtr->rootBlock = removeTreeBlock(memMapPtr->rootBlock, temp);
+         }
+       else if (temp->height > 0
+                           && memMapPtr->placementCode == MEM_PLACE_BUDDY_CODE)
+         {
+          memMapPtr = releaseBuddy(memMapPtr, temp->physBase, 
+                                                 temp->memOffset + MEM_SHIFT);
+         }
+       else if (temp->height > 0)
+         {
+          memMapPtr = releaseMemory(memMapPtr, temp->physBase, 
+                                                 temp->memOffset + MEM_SHIFT);
+         }
+
+       free(temp);
+      }
+
+    // the process address tree only held these blocks
+    prcPtr->memTree = NULL;
+
+    return memMapPtr;
+   }
+
+// takes a free extent out of both free memory trees
+memoryMapType *removeFreeExtent(memoryMapType *memMapPtr,
+                                                       freeBlockType *blockPtr)
+   {
+    // initialize function/variables
+    int order;
+
+    for (order = 0; order < FREE_TREE_COUNT; order++)
+      {
+       memMapPtr->freeRoot[order] = removeFreeBlock(memMapPtr->freeRoot[order],
+                                                              blockPtr, order);
+      }
+
+    return memMapPtr;
    }
 
-// function for identifying valid memory access request
-bool findAccess(memoryType *memPtr, int prcId, int accessBase, int accessOffset)
+// takes a free extent out of one of the free memory trees, returns the 
+// new tree root
+freeBlockType *removeFreeBlock(freeBlockType *rootPtr, freeBlockType *blockPtr,
+                                                                     int order)
    {
     // initialize function/variables
-    int memSize, accessSize = accessBase + accessOffset;
+    freeBlockType *nextPtr;
 
-    // iterate through the memory linked list
-    while (memPtr != NULL)
+    // look for the extent on the side it belongs on
+    if (freeBlockBefore(blockPtr, rootPtr, order))
       {
-       // calculate the size of memory access request
-       memSize = memPtr->memBase + memPtr->memOffset;
-
-       // check if the request base is compatible
-       if (accessBase >= memPtr->memBase && accessBase < memSize)
-         {
-          // check if request size is compatible and correct process allocation
-          if ((accessSize > accessBase && accessSize <= memSize) 
-                                                && prcId == memPtr->processId)
-            {
-             // return that access request is valid
-             return true;
-            }
-         }
-       // point the working pointer to the next node pointer
-       memPtr = memPtr->nextBlock;
+       rootPtr->lowerBlock[order] = removeFreeBlock(rootPtr->lowerBlock[order],
+                                                              blockPtr, order);
+      }
+    else if (freeBlockBefore(rootPtr, blockPtr, order))
+      {
+       rootPtr->higherBlock[order]
+               = removeFreeBlock(rootPtr->higherBlock[order], blockPtr, order);
       }
-    
-    // return access request not valid
-    return false;
-   }
 
-// function for identifying valid memory allocation request
-bool findConflict(int desiredBase, int desiredOffset, int memAvailable,
-                                                         memoryType *memWkgPtr)
-   { 
-    // initialize function/variables
-    int currBase, currSize, 
-        desiredSize = desiredBase + desiredOffset - MEM_SHIFT;
-    
-    // check for allocation request outside of sim memory boundaries
-    if (desiredBase >= memAvailable || desiredSize > memAvailable)
+    // this is the extent, an extent with one side is replaced by that side
+    else if (rootPtr->lowerBlock[order] == NULL
+                                        || rootPtr->higherBlock[order] == NULL)
       {
-       // return conflict found
-       return true;
-      }      
-    
-    // loop throught the memory linked list
-    while (memWkgPtr != NULL)
+       return rootPtr->lowerBlock[order] != NULL ? rootPtr->lowerBlock[order]
+                                                 : rootPtr->higherBlock[order];
+      }
+
+    // otherwise the next extent in order takes its place
+    else
       {
-       // assign the current base and size to integers for readability
-       currBase = memWkgPtr->memBase;
-       currSize = currBase + memWkgPtr->memOffset;
+       nextPtr = rootPtr->higherBlock[order];
 
-       // check if the allocation request conflicts with current node allocation
-       if ((desiredBase >= currBase && desiredBase <= (currSize))
-                        || (desiredSize >= currBase && desiredSize <= currSize))
+       while (nextPtr->lowerBlock[order] != NULL)
          {
-          // notify simulation of invalid allocation request
-          return true;
+          nextPtr = nextPtr->lowerBlock[order];
          }
-       // point the working pointer to the next node pointer
-       memWkgPtr = memWkgPtr->nextBlock;
+
+       nextPtr->higherBlock[order]
+                = removeFreeBlock(rootPtr->higherBlock[order], nextPtr, order);
+
+       nextPtr->lowerBlock[order] = rootPtr->lowerBlock[order];
+
+       rootPtr = nextPtr;
       }
-    
-    // notify simulation of valid allocation request
-    return false;
+
+    return balanceFreeBlock(rootPtr, order);
    }
 
-// function for handling all memory related actions
-memoryType *handleMemory(processType *prcCurrent, ConfigDataType *configPtr, 
-                                          memoryType *memHeadPtr, int *memCode)
+// takes a block out of the address tree, returns the new tree root
+memoryType *removeTreeBlock(memoryType *rootPtr, memoryType *blockPtr)
    {
-    // determine memory action type
-    switch (*memCode)
-      {
-       // handle allocation request
-       case ALLOCATE:
-          if (!findConflict(prcCurrent->opHeadPtr->intArg2, 
-                                    prcCurrent->opHeadPtr->intArg3,
-                                          configPtr->memAvailable, memHeadPtr))
-            {
-             // store allocation pcb struct as valid request
-             memHeadPtr = addMemoryNode(memHeadPtr, prcCurrent->processId,
-                                                prcCurrent->opHeadPtr->intArg2,
-                                                prcCurrent->opHeadPtr->intArg3);
-
-             // set memory code to ALLOCATE_SUCCESS
-             *memCode = ALLOCATE_SUCCESS;
-            }
-          else
-            {
-             *memCode = ALLOCATE_FAILIURE;
-            }
-       break;
-       
-       // handle access request
-       case ACCESS:
-          // check if pcb node was allocated
-          if (findAccess(memHeadPtr, prcCurrent->processId,
-                                             prcCurrent->opHeadPtr->intArg2,
-                                                prcCurrent->opHeadPtr->intArg3))
-            {
-             *memCode = ACCESS_SUCCESS;
-            }
-          // otherwise
-          else
-            {
-             *memCode = ACCESS_FAILIURE;
-            }
-       break;
-       
-       // handle deallocation request
-       case DEALLOCATE:
-          memHeadPtr = removeBlock(memHeadPtr, prcCurrent);
+    // initialize function/variables
+    memoryType *nextPtr;
 
-       break;
-       
-       // handle deinitialize request
-       case DEINITIALIZE:
-          memHeadPtr = clearMemory(memHeadPtr);
-       break;
+    // look for the block on the side its base belongs on
+    if (blockPtr->memBase < rootPtr->memBase)
+      {
+       rootPtr->lowerBlock = removeTreeBlock(rootPtr->lowerBlock, blockPtr);
+      }
+    else if (blockPtr->memBase > rootPtr->memBase)
+      {
+       rootPtr->higherBlock = removeTreeBlock(rootPtr->higherBlock, blockPtr);
       }
 
-    // display output
-    if (configPtr->memDisplay && configPtr->logToCode != LOGTO_FILE_CODE)
+    // bases are unique, so this is the block, a block with one side
+    // is replaced by that side
+    else if (rootPtr->lowerBlock == NULL || rootPtr->higherBlock == NULL)
       {
-       memoryStringEngine(memHeadPtr, prcCurrent, configPtr->memAvailable, 
-                                                                     memCode);
+       return rootPtr->lowerBlock != NULL ? rootPtr->lowerBlock 
+                                                       : rootPtr->higherBlock;
       }
-   
-    // return memory head pointer
-    return memHeadPtr;
-   }
 
-// check if process has memory allocated
-bool inMemory(processType *prcPtr, memoryType *memPtr)
-   {
-    // loop until end of memory linked list
-    while (memPtr != NULL)
+    // otherwise the next higher block takes its place
+    else
       {
-       // check if memory block is assigned to process
-       if (prcPtr->processId == memPtr->processId)
+       nextPtr = rootPtr->higherBlock;
+
+       while (nextPtr->lowerBlock != NULL)
          {
-          // notify simulator of valid ownership
-          return true;
+          nextPtr = nextPtr->lowerBlock;
          }
 
-       // point the working pointer to the next node pointer
-       memPtr = memPtr->nextBlock;
+       nextPtr->higherBlock = removeTreeBlock(rootPtr->higherBlock, nextPtr);
+
+       nextPtr->lowerBlock = rootPtr->lowerBlock;
+
+       rootPtr = nextPtr;
       }
-    // notify simulation of no ownership found
-    return false;
+
+    return balanceBlock(rootPtr);
    }
 
-// function for generating memory display
-void memoryStringEngine(memoryType *memHeadPtr, processType *prcPtr,
-                                                 int totalMemory, int *memCode)
+// rotates a subtree so its higher child becomes the root when moving
+// the root to the lower side, or its lower child otherwise, returns the
+// new subtree root
+memoryType *rotateBlock(memoryType *blockPtr, bool toLower)
    {
-    int memDispBase = 0;
+    // initialize function/variables
+    memoryType *newRootPtr;
 
-    printf("%s", MEM_LINE);
+    if (toLower)
+      {
+       newRootPtr = blockPtr->higherBlock;
 
-    switch (*memCode)
+       blockPtr->higherBlock = newRootPtr->lowerBlock;
+
+       newRootPtr->lowerBlock = blockPtr;
+      }
+    else
       {
-       case INITIALIZE:
-       printf("After memory initialization\n");
-       break;
-       
-       case ALLOCATE_SUCCESS:
-       printf("After allocate success\n");
-       break;
+       newRootPtr = blockPtr->lowerBlock;
 
-       case ALLOCATE_FAILIURE:
-       printf("After allocate failiure\n");
-       break;
+       blockPtr->lowerBlock = newRootPtr->higherBlock;
 
-       case ACCESS_SUCCESS:
-       printf("After access success\n");
-       break;
+       newRootPtr->higherBlock = blockPtr;
+      }
 
-       case ACCESS_FAILIURE:
-       printf("After access failiure\n");
-       break;
+    updateBlockHeight(blockPtr);
 
-       case DEALLOCATE:
-       printf("After clear process %d success\n", prcPtr->processId);
-       break;
+    updateBlockHeight(newRootPtr);
 
-       case DEINITIALIZE:
-       printf("After clear all process success\nNo memory configured\n");
-       break;
-      }
+    return newRootPtr;
+   }
 
-    while(memHeadPtr != NULL)
+// rotates a free memory subtree in one of its orders, as rotateBlock
+// does, returns the new subtree root
+freeBlockType *rotateFreeBlock(freeBlockType *blockPtr, bool toLower, int order)
+   {
+    // initialize function/variables
+    freeBlockType *newRootPtr;
+
+    if (toLower)
       {
-       printf("%d [ Used, P# %d, %d-%d] %d\n", memDispBase, 
-                           memHeadPtr->processId, memHeadPtr->memBase, 
-                              memHeadPtr->memBase + memHeadPtr->memOffset, 
-                                          memDispBase + memHeadPtr->memOffset);
+       newRootPtr = blockPtr->higherBlock[order];
 
-       memDispBase = memDispBase + memHeadPtr->memOffset + MEM_SHIFT;
-       memHeadPtr = memHeadPtr->nextBlock;
-      }    
+       blockPtr->higherBlock[order] = newRootPtr->lowerBlock[order];
 
-    if (*memCode != DEINITIALIZE)
+       newRootPtr->lowerBlock[order] = blockPtr;
+      }
+    else
       {
-       printf("%d [ Open, P#: x, 0-0 ] %d\n", memDispBase, 
-                                                      totalMemory - MEM_SHIFT);
+       newRootPtr = blockPtr->lowerBlock[order];
+
+       blockPtr->lowerBlock[order] = newRootPtr->higherBlock[order];
+
+       newRootPtr->higherBlock[order] = blockPtr;
       }
-    
-    printf("%s", MEM_LINE);
+
+    updateFreeBlock(blockPtr, order);
+
+    updateFreeBlock(newRootPtr, order);
+
+    return newRootPtr;
    }
 
-memoryType *removeBlock(memoryType *memHeadPtr, processType *prcPtr)
+// marks a buddy block free or taken, updating each level above whose
+// word becomes empty or stops being empty
+void setBuddyBit(buddyBitmapType *bitmapPtr, long long index, bool isFree)
    {
-    memoryType *memWkgPtr, *temp, *prevPtr;
+    // initialize function/variables
+    long long word;
+    unsigned long long *wordPtr;
+    int level;
+    bool changed = true;
 
-    while (inMemory(prcPtr, memHeadPtr))
+    for (level = 0; level < bitmapPtr->levelCount && changed; level++)
       {
-       if (memHeadPtr->processId == prcPtr->processId)
+       word = index / BUDDY_WORD_BITS;
+
+       wordPtr = &bitmapPtr->levelBits[level][word];
+
+       if (isFree)
          {
-          temp = memHeadPtr;
-          memHeadPtr = memHeadPtr->nextBlock;
-          free(temp);
+          changed = *wordPtr == 0;
+
+          *wordPtr |= 1ULL << (index % BUDDY_WORD_BITS);
          }
        else
          {
-          memWkgPtr = memHeadPtr->nextBlock;
-          prevPtr = memHeadPtr;
+          *wordPtr &= ~(1ULL << (index % BUDDY_WORD_BITS));
 
-          while (memWkgPtr != NULL)
-            {
-             if (memWkgPtr->processId == prcPtr->processId)
-               {
-                prevPtr->nextBlock = memWkgPtr->nextBlock;
-                free(memWkgPtr);
-                memWkgPtr = prevPtr->nextBlock;
-               }
-             else
-               {
-                memWkgPtr = memWkgPtr->nextBlock;
-                prevPtr = prevPtr->nextBlock;
-               }
-            }
+          changed = *wordPtr == 0;
          }
+
+       index = word;
       }
+   }
+
+// checks whether a buddy block is free
+bool testBuddyBit(buddyBitmapType *bitmapPtr, long long index)
+   {
+    return (bitmapPtr->levelBits[0][index / BUDDY_WORD_BITS] 
+                                    >> (index % BUDDY_WORD_BITS)) & 1;
+   }
+
+// sets the height of a block from the heights of its children
+void updateBlockHeight(memoryType *blockPtr)
+   {
+    // initialize function/variables
+    int lowerHeight = blockHeight(blockPtr->lowerBlock),
+        higherHeight = blockHeight(blockPtr->higherBlock);
+
+    blockPtr->height
+             = (lowerHeight > higherHeight ? lowerHeight : higherHeight) + 1;
+   }
+
+// sets the height of a free extent in one of its orders from its 
+// children, and the largest extent under it in the base ordered tree
+void updateFreeBlock(freeBlockType *blockPtr, int order)
+   {
+    // initialize function/variables
+    freeBlockType *lowerPtr = blockPtr->lowerBlock[order],
+                  *higherPtr = blockPtr->higherBlock[order];
+    int lowerHeight = freeBlockHeight(lowerPtr, order),
+        higherHeight = freeBlockHeight(higherPtr, order);
+
+    blockPtr->height[order]
+             = (lowerHeight > higherHeight ? lowerHeight : higherHeight) + 1;
+
+    if (order == FREE_BY_BASE)
+      {
+       blockPtr->largestSize = blockPtr->size;
 
-    return memHeadPtr;
+       if (lowerPtr != NULL && lowerPtr->largestSize > blockPtr->largestSize)
+         {
+          blockPtr->largestSize = lowerPtr->largestSize;
+         }
+
+       if (higherPtr != NULL && higherPtr->largestSize > blockPtr->largestSize)
+         {
+          blockPtr->largestSize = higherPtr->largestSize;
+         }
+      }
    }
 
 
@@ -874,9 +3050,9 @@ bool allProcessExit(processType *prcPtr)
     return true;
    }
 
-int calculateRunTime(processType *prcPtr, ConfigDataType *cfgPtr)
+long long calculateRunTime(processType *prcPtr, ConfigDataType *cfgPtr)
    {
-    int total = 0;
+    long long total = 0;
     
     OpCodeType *opPtr = prcPtr->opHeadPtr;
 
@@ -916,8 +3092,6 @@ processType *clearProcesses(processType *prcPtr)
 
        prcPtr->opHeadPtr = clearMetaDataList(prcPtr->opHeadPtr);
 
-       free(prcPtr->interruptQueue);
-
        free(prcPtr);
 
        prcPtr = temp;
@@ -950,10 +3124,10 @@ processType *findProcess(processType *prcWkgPtr, int prcToFind)
     return NULL;
    }
 
-processType *getProcess(processType *prcPtr, ConfigDataType *cfgPtr, bool *quantumCyclesHit)
+processType *getProcess(processType *prcPtr, ConfigDataType *cfgPtr,
+                              bool *quantumCyclesHit, processType **lastPrcPtr)
    {
-    processType *prcToSched = NULL, *prcHead = prcPtr;
-    static processType *lastPrc = NULL;
+    processType *prcToSched = NULL, *prcHead = prcPtr, *lastPrc = *lastPrcPtr;
 
     if (prcPtr != NULL)
       {
@@ -1062,7 +3236,7 @@ processType *getProcess(processType *prcPtr, ConfigDataType *cfgPtr, bool *quant
          }
       }
 
-    lastPrc = prcToSched;
+    *lastPrcPtr = prcToSched;
     prcToSched->processRunTime = calculateRunTime(prcToSched, cfgPtr);
     return prcToSched;
    }
@@ -1078,6 +3252,9 @@ processType *initializeProcess(processType *prcPtr, int prcId)
        prcPtr->opHeadPtr = NULL;
        prcPtr->nextPtr = NULL;
        prcPtr->interruptQueue = NULL;
+       prcPtr->timerPtr = NULL;
+       prcPtr->memBlocks = NULL;
+       prcPtr->memTree = NULL;
       }
     else
       {
@@ -1110,10 +3287,9 @@ bool lastProcessAvailable(processType *prcPtr, int totalCount)
     return false;
    }
 
-processType *uploadToPCB(OpCodeType *opWkgPtr, ConfigDataType *cfgPtr, processType *pcbPtr)
+processType *uploadToPCB(OpCodeType *opWkgPtr, ConfigDataType *cfgPtr,
+                                                processType *pcbPtr, int prcId)
    {
-    static int processCount = 0;
-   
     if (compareString(opWkgPtr->command, "sys") != STR_EQ 
                         && compareString(opWkgPtr->strArg1, "end") != STR_EQ)
       {
@@ -1122,7 +3298,7 @@ processType *uploadToPCB(OpCodeType *opWkgPtr, ConfigDataType *cfgPtr, processTy
           if (compareString(opWkgPtr->command, "app") == STR_EQ 
                         && compareString(opWkgPtr->strArg1, "start")== STR_EQ)
             {
-             pcbPtr = initializeProcess(pcbPtr, processCount);
+             pcbPtr = initializeProcess(pcbPtr, prcId);
 
              opWkgPtr = opWkgPtr->nextNode;
 
@@ -1135,11 +3311,10 @@ processType *uploadToPCB(OpCodeType *opWkgPtr, ConfigDataType *cfgPtr, processTy
                }
 
              pcbPtr->ioCycleTime = cfgPtr->ioCycleRate;
-
-             processCount++;
             }
          }
-       pcbPtr->nextPtr = uploadToPCB(opWkgPtr->nextNode, cfgPtr, pcbPtr->nextPtr);
+       pcbPtr->nextPtr = uploadToPCB(opWkgPtr->nextNode, cfgPtr,
+                                                   pcbPtr->nextPtr, prcId + 1);
       }
     return pcbPtr;
    }
@@ -1172,18 +3347,23 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
     // structure head and working ptrs
     logFileType *logFileHeadPtr = NULL;
     processType *prcHeadPtr = NULL, *prcWkgPtr = NULL, *tempPtr = NULL;
-    memoryType *memHeadPtr = NULL;
-    
-    // pthread id
-    pthread_t *thread_id;
+    processType *lastPrcPtr = NULL;
+    memoryMapType *memMapPtr = NULL;
+    eventQueueType *eventQueue = NULL;
+    deviceServerType *deviceServers = NULL;
+    diskType *diskPtr = NULL;
 
     // string to store output
-    char displayString[MAX_STR_LEN], timeString[MIN_STR_LEN];
+    char displayString[MAX_STR_LEN];
+
+    // simulation timestamp and total cpu idle time in nanoseconds
+    long long lapTime, idleStart, idleTime = 0;
     
     // run time in miliseconds, memoryCode storage and number of processes var
-    int memoryCode, prcCount, cpuCycleCount = 0;
+    int memoryCode, prcCount, cpuCycleCount = 0, batchCycles, ioWorkers,
+                                                                    deviceCode;
     
-    int *interruptQueue = NULL;
+    InterruptQueueType *interruptQueue = NULL;
     
     // flags
     bool quantCycleHit = false;
@@ -1191,28 +3371,41 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
     bool lastMsgOS = false;
 
     bool isPreemptive = checkPreemptive(configPtr);
-    
-    // initialize semaphore lock
-    sem_init(&interruptLock, 0, 1);
 
+    bool isVirtual = configPtr->clockCode == CLOCK_VIRTUAL_CODE;
+
+    bool drainInterrupts
+                   = configPtr->interruptDrainCode == INTERRUPT_BATCH_CODE;
+
+    // timer owned by this simulation, on the wall or virtual clock,
+    // wait codes are listed in the same order as the timer wait codes
+    SimTimerType *simTimer = createTimer(isVirtual ? VIRTUAL_CLOCK : WALL_CLOCK,
+                         configPtr->timerWaitCode - TIMER_SPIN_CODE + SPIN_WAIT,
+                               configPtr->spinSliceUSec, configPtr->timeScale);
+    
     // check for sytem start command
     if (compareString(metaDataMstrPtr->command, "sys") == STR_EQ 
                && compareString(metaDataMstrPtr->strArg1, "start") == STR_EQ)
       {
        // check for file output and notify user
-       if (configPtr->logToCode == LOGTO_FILE_CODE)
+       if (configPtr->logToCode != LOGTO_MONITOR_CODE 
+                                  && configPtr->logToCode != LOGTO_BOTH_CODE)
          {
           // print file output notice
           printf("Writing output to file!\n");
          }
        
+       // open the log file and write its header, lines are then 
+       // streamed to it as they are logged
+       logFileHeadPtr = openLogFile(configPtr, displayString);
+
        // display begin simulation output
-       sprintf(displayString, "Begin Simulation\n\n");
-       logFileHeadPtr = displayCommand(logFileHeadPtr, displayString, 
-                                                         configPtr->logToCode);       
+       logFileHeadPtr = osRecordEngine(logFileHeadPtr, TRACE_BEGIN_SIM,
+                  0, DEVICE_COUNT, 0, 0, configPtr, displayString, &lastMsgOS);
 
        // get op codes and organize them by process
-       prcHeadPtr = uploadToPCB(metaDataMstrPtr->nextNode, configPtr, prcHeadPtr);
+       prcHeadPtr = uploadToPCB(metaDataMstrPtr->nextNode, configPtr,
+                                                      prcHeadPtr, FIRST_INDEX);
 
        // get the number of processes loaded in the pcb
        prcCount = countProcesses(prcHeadPtr);
@@ -1221,28 +3414,59 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
        // as that is the maximum amount
        interruptQueue = interruptManager(prcHeadPtr, interruptQueue, prcCount, INITIALIZE_QUEUE);
        
-       thread_id = malloc(sizeof(pthread_t) * prcCount);
+       // size the io worker pool, one per core unless configured, and
+       // no more than the processes that can be blocked at once
+       ioWorkers = configPtr->ioWorkers;
+
+       if (ioWorkers == 0)
+         {
+          ioWorkers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+         }
+
+       if (ioWorkers > prcCount)
+         {
+          ioWorkers = prcCount;
+         }
+
+       // the virtual clock delivers completions from the main loop
+       if (isVirtual)
+         {
+          ioWorkers = 0;
+         }
+
+       // create the device servers that queue io operations, and the 
+       // disk model if one is selected
+       deviceServers = createDeviceServers(configPtr);
+
+       diskPtr = createDisk(configPtr);
+
+       // create the io completion queue, sized for one pending event 
+       // per process
+       eventQueue = createEventQueue(simTimer, interruptQueue, prcCount,
+                                                                    ioWorkers);
 
        // set a working pointer to the pcb head ptr
        prcWkgPtr = prcHeadPtr;
        
-       accessTimer(ZERO_TIMER, timeString);
+       accessTimer(simTimer, ZERO_TIMER);
 
        // display simulator start
-       logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                SIM_START, IGNORE_STATE, IGNORE_MEM_CODE, 
-                                                                   displayString, isPreemptive, &lastMsgOS);
+       logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, simTimer,
+            configPtr, SIM_START, IGNORE_STATE, IGNORE_MEM_CODE, displayString,
+                                                     isPreemptive, &lastMsgOS);
        
        // ready all new processes in the pcb
        while (prcWkgPtr != NULL)
          {
           // display process state change to ready
-          logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode,
-                                                   IGNORE_OSCODE, READY_STATE, IGNORE_MEM_CODE, 
-                                                                         displayString, isPreemptive, &lastMsgOS);
+          logFileHeadPtr = logStateChange(prcWkgPtr, logFileHeadPtr, simTimer,
+              configPtr, READY_STATE, displayString, isPreemptive, &lastMsgOS);
           
           // change state value within process node
           prcWkgPtr->processState = READY_STATE;
+
+          // share this simulation's timer with the io workers
+          prcWkgPtr->timerPtr = simTimer;
           
           // point the process working pointer to the next node
           prcWkgPtr = prcWkgPtr->nextPtr;
@@ -1252,7 +3476,7 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
        memoryCode = INITIALIZE;
        
        // initialize memory
-       memHeadPtr = handleMemory(prcHeadPtr, configPtr, memHeadPtr, &memoryCode);
+       memMapPtr = handleMemory(prcHeadPtr, configPtr, memMapPtr, &memoryCode);
        
        // master loop (loops while all processes are not exit state)
        while (!allProcessExit(prcHeadPtr))
@@ -1260,52 +3484,87 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
           
           if (allProcessBlocked(prcHeadPtr))
             {
-             accessTimer(LAP_TIMER, timeString);
+             lapTime = accessTimer(simTimer, LAP_TIMER);
+
+             idleStart = lapTime;
 
-             sprintf(displayString, "%s, OS: CPU idle, all active processes blocked\n", timeString);
+             logFileHeadPtr = osRecordEngine(logFileHeadPtr, TRACE_CPU_IDLE,
+                         lapTime, DEVICE_COUNT, 0, 0, configPtr, displayString,
+                                                                   &lastMsgOS);
+
+             // skip the virtual clock ahead to the next io completion
+             if (isVirtual)
+               {
+                runTimerUntil(simTimer, nextEventTime(eventQueue));
 
-             logFileHeadPtr = displayCommand(logFileHeadPtr, displayString, configPtr->logToCode);
+                deliverEvents(eventQueue, accessTimer(simTimer, LAP_TIMER));
+               }
 
-             while (interruptQueue[FIRST_INDEX] == EMPTY_QUEUE_VALUE)
+             // otherwise show the buffered monitor output before waiting
+             else
                {
-                // enjoy the wait, play some checkers really fast or something
+                fflush(stdout);
                }
 
-             accessTimer(LAP_TIMER, timeString);
+             // sleep until an io completion raises an interrupt
+             waitForInterrupt(interruptQueue);
 
-             sprintf(displayString, "%s, OS: CPU interrupt, end idle\n", timeString);
-             
-             logFileHeadPtr = displayCommand(logFileHeadPtr, displayString, configPtr->logToCode);
+             // account the time spent idle
+             lapTime = accessTimer(simTimer, LAP_TIMER);
+
+             idleTime += lapTime - idleStart;
+
+             logFileHeadPtr = osRecordEngine(logFileHeadPtr, TRACE_IDLE_END,
+                         lapTime, DEVICE_COUNT, 0, 0, configPtr, displayString,
+                                                                   &lastMsgOS);
              
-             prcWkgPtr = findProcess(prcHeadPtr, interruptQueue[FIRST_INDEX]);
+             // service the oldest interrupt, or every pending one when draining
+             do
+               {
+                prcWkgPtr = findProcess(prcHeadPtr,
+                                           peekInterruptQueue(interruptQueue));
 
-             logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                             CPU_INTERRUPT, IGNORE_STATE, IGNORE_MEM_CODE, displayString, isPreemptive, &lastMsgOS);
+                logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr,
+                              simTimer, configPtr, CPU_INTERRUPT, IGNORE_STATE,
+                     IGNORE_MEM_CODE, displayString, isPreemptive, &lastMsgOS);
 
-             logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                             IGNORE_OSCODE, READY_STATE, IGNORE_MEM_CODE, displayString, isPreemptive, &lastMsgOS);
+                logFileHeadPtr = logStateChange(prcWkgPtr, logFileHeadPtr,
+                               simTimer, configPtr, READY_STATE, displayString,
+                                                     isPreemptive, &lastMsgOS);
 
-             interruptManager(prcWkgPtr, interruptQueue, prcCount, HANDLE_INTERRUPT);
+                interruptManager(prcWkgPtr, interruptQueue, prcCount,
+                                                             HANDLE_INTERRUPT);
+               }
+             while (drainInterrupts
+                   && peekInterruptQueue(interruptQueue) != EMPTY_QUEUE_VALUE);
             }
 
+          // remember the running process, the scheduler readies it without
+          // a log line when another process is selected
+          tempPtr = lastPrcPtr != NULL
+                    && lastPrcPtr->processState == RUNNING_STATE
+                                                           ? lastPrcPtr : NULL;
          
-          prcWkgPtr = getProcess(prcHeadPtr, configPtr, &quantCycleHit);
-
+          prcWkgPtr = getProcess(prcHeadPtr, configPtr, &quantCycleHit,
+                                                                  &lastPrcPtr);
 
-          if ( prcWkgPtr->processState == READY_STATE)
+          if (tempPtr != NULL && tempPtr->processState == READY_STATE)
             {
-             
-             accessTimer(LAP_TIMER, timeString);
+             logFileHeadPtr = osStringEngine(tempPtr, logFileHeadPtr, simTimer,
+                         configPtr, CPU_PREEMPT, IGNORE_STATE, IGNORE_MEM_CODE,
+                                      displayString, isPreemptive, &lastMsgOS);
+            }
 
-             sprintf(displayString, 
-                        "%s, OS: Process %d selected with %d ms remaining\n", 
-                                                timeString, prcWkgPtr->processId, prcWkgPtr->processRunTime);
 
-             logFileHeadPtr = displayCommand(logFileHeadPtr, displayString, configPtr->logToCode);
+          if ( prcWkgPtr->processState == READY_STATE)
+            {
+             logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr,
+                              simTimer, configPtr, PROCESS_START, IGNORE_STATE,
+                     IGNORE_MEM_CODE, displayString, isPreemptive, &lastMsgOS);
 
-             logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode,
-                                           IGNORE_OSCODE, RUNNING_STATE, IGNORE_MEM_CODE, 
-                                                                     displayString, isPreemptive, &lastMsgOS);
+             logFileHeadPtr = logStateChange(prcWkgPtr, logFileHeadPtr,
+                             simTimer, configPtr, RUNNING_STATE, displayString,
+                                                     isPreemptive, &lastMsgOS);
             }
 
           prcWkgPtr->processState = RUNNING_STATE;
@@ -1313,32 +3572,61 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
 
           if (prcWkgPtr->opHeadPtr != NULL)
             {
-             logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr, logFileHeadPtr, 
-                                                                prcWkgPtr->processId, COMMAND_START, 
-                                                                        configPtr->logToCode, displayString, isPreemptive, &lastMsgOS);
+             logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr,
+                 logFileHeadPtr, simTimer, prcWkgPtr->processId, COMMAND_START,
+                           configPtr, displayString, isPreemptive, &lastMsgOS);
 
              if (compareString(prcWkgPtr->opHeadPtr->command, "dev") == STR_EQ)
                {
                 if (isPreemptive)
                   {
-                   logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                         BLOCKED_IO, IGNORE_STATE, IGNORE_MEM_CODE, 
-                                                                               displayString, isPreemptive, &lastMsgOS);
-
-                   logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                         IGNORE_OSCODE, BLOCKED_STATE, IGNORE_MEM_CODE, 
-                                                                               displayString, isPreemptive, &lastMsgOS);
+                   logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr,
+                                 simTimer, configPtr, BLOCKED_IO, IGNORE_STATE,
+                                  IGNORE_MEM_CODE, displayString, isPreemptive,
+                                                                   &lastMsgOS);
+
+                   logFileHeadPtr = logStateChange(prcWkgPtr, logFileHeadPtr,
+                             simTimer, configPtr, BLOCKED_STATE, displayString,
+                                                     isPreemptive, &lastMsgOS);
                    prcWkgPtr->processState = BLOCKED_STATE;
                 
-                   pthread_create(&thread_id[prcWkgPtr->processId], NULL, handleIO, (void *)prcWkgPtr);
+                   // hard drive operations wait for the disk head when the disk
+                   // model is on, its scheduler decides when they complete
+                   if (diskPtr != NULL 
+                        && getDeviceCode(prcWkgPtr->opHeadPtr->strArg1)
+                                                          == HARD_DRIVE_DEVICE)
+                     {
+                      submitDiskRequest(diskPtr, eventQueue, prcWkgPtr,
+                                                 prcWkgPtr->opHeadPtr->intArg3,
+                                              accessTimer(simTimer, LAP_TIMER),
+                                              (long long)prcWkgPtr->ioCycleTime
+                                                * prcWkgPtr->opHeadPtr->intArg2
+                                                              * NSEC_PER_MSEC);
+                     }
+
+                   // otherwise queue the operation on its device, then record
+                   // when the io completes, the virtual clock delivers it from
+                   // the main loop and the wall clock from the io workers
+                   else
+                     {
+                      addEvent(eventQueue, prcWkgPtr, NULL,
+                                                scheduleDeviceOp(deviceServers,
+                                                 prcWkgPtr->opHeadPtr->strArg1,
+                                              accessTimer(simTimer, LAP_TIMER),
+                                              (long long)prcWkgPtr->ioCycleTime
+                                                * prcWkgPtr->opHeadPtr->intArg2
+                                                             * NSEC_PER_MSEC));
+                     }
                   }
                 else
                   {
-                   runTimer(prcWkgPtr->ioCycleTime * prcWkgPtr->opHeadPtr->intArg2);
+                   runTimer(simTimer,
+                       prcWkgPtr->ioCycleTime * prcWkgPtr->opHeadPtr->intArg2);
 
-                   logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr, logFileHeadPtr,
-                                                                        prcWkgPtr->processId, COMMAND_END,
-                                                                                configPtr->logToCode, displayString, isPreemptive, &lastMsgOS);
+                   logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr,
+                                logFileHeadPtr, simTimer, prcWkgPtr->processId,
+                           COMMAND_END, configPtr, displayString, isPreemptive,
+                                                                   &lastMsgOS);
                    prcWkgPtr->opHeadPtr = clearOpCommand(prcWkgPtr->opHeadPtr);
                   }
                }
@@ -1356,12 +3644,22 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
                    memoryCode = ACCESS;
                   }
 
-                memHeadPtr = handleMemory(prcWkgPtr, configPtr, memHeadPtr, 
+                memMapPtr = handleMemory(prcWkgPtr, configPtr, memMapPtr, 
                                                                   &memoryCode);
 
-                logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr, 
-                                                     logFileHeadPtr,  prcWkgPtr->processId, memoryCode, 
-                                                      configPtr->logToCode, displayString, isPreemptive, &lastMsgOS);
+                logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr,
+                   logFileHeadPtr, simTimer,  prcWkgPtr->processId, memoryCode,
+                           configPtr, displayString, isPreemptive, &lastMsgOS);
+
+                // report where the buddy system placed the allocation
+                if (memoryCode == ALLOCATE_SUCCESS 
+                           && memMapPtr->placementCode == MEM_PLACE_BUDDY_CODE
+                                       && prcWkgPtr->opHeadPtr->intArg3 > 0)
+                  {
+                   logFileHeadPtr = memRecordEngine(logFileHeadPtr, simTimer,
+                                    prcWkgPtr->processId, memMapPtr, configPtr,
+                                                    displayString, &lastMsgOS);
+                  }
 
                 prcWkgPtr->opHeadPtr = clearOpCommand(prcWkgPtr->opHeadPtr);
                }
@@ -1373,16 +3671,38 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
                   {
                    while (cpuCycleCount != configPtr->quantumCycles 
                      && prcWkgPtr->opHeadPtr->intArg2 != EMPTY_CYCLE_COUNT
-                     && interruptQueue[FIRST_INDEX] == EMPTY_QUEUE_VALUE)
+                     && peekInterruptQueue(interruptQueue) == EMPTY_QUEUE_VALUE)
                      {
-                      runTimer(configPtr->procCycleRate);
-                      cpuCycleCount++;
-                      prcWkgPtr->opHeadPtr->intArg2--;
+                      // run one cycle, or every cycle up to the next event
+                      // when batching
+                      batchCycles = 1;
+
+                      if (configPtr->cpuBatching)
+                        {
+                         batchCycles
+                            = cyclesToHorizon(nextEventTime(eventQueue),
+                                             accessTimer(simTimer, LAP_TIMER),
+                                                      configPtr->procCycleRate,
+                                      configPtr->quantumCycles - cpuCycleCount,
+                                                prcWkgPtr->opHeadPtr->intArg2);
+                        }
+
+                      runTimer(simTimer,
+                                       configPtr->procCycleRate * batchCycles);
+                      cpuCycleCount += batchCycles;
+                      prcWkgPtr->opHeadPtr->intArg2 -= batchCycles;
+
+                      if (isVirtual)
+                        {
+                         deliverEvents(eventQueue,
+                                             accessTimer(simTimer, LAP_TIMER));
+                        }
                      }
                   }
                 else
                   {
-                   runTimer(configPtr->procCycleRate * prcWkgPtr->opHeadPtr->intArg2);
+                   runTimer(simTimer,
+                      configPtr->procCycleRate * prcWkgPtr->opHeadPtr->intArg2);
                    prcWkgPtr->opHeadPtr->intArg2 = EMPTY_CYCLE_COUNT;
                   }
                    
@@ -1390,40 +3710,56 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
 
                 //printf("\n-- Process Id: %d, Cycles Left: %d --\n\n", prcWkgPtr->processId, prcWkgPtr->opHeadPtr->intArg2);
 
-                if (interruptQueue[FIRST_INDEX] != EMPTY_QUEUE_VALUE && isPreemptive)
+                if (peekInterruptQueue(interruptQueue) != EMPTY_QUEUE_VALUE
+                                                               && isPreemptive)
                   {
-                   logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr, logFileHeadPtr,  
-                                                                    prcWkgPtr->processId, COMMAND_END, 
-                                                                        configPtr->logToCode, displayString, isPreemptive, &lastMsgOS);
-
-                   tempPtr = findProcess(prcHeadPtr, interruptQueue[FIRST_INDEX]);
-                   
-                   logFileHeadPtr = displayCommand(logFileHeadPtr, "\n", configPtr->logToCode);
+                   logFileHeadPtr = logCpuOp(prcWkgPtr->processId,
+                              logFileHeadPtr, simTimer, configPtr, COMMAND_END,
+                                      displayString, isPreemptive, &lastMsgOS);
 
-                   logFileHeadPtr = osStringEngine(tempPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                      CPU_INTERRUPT, IGNORE_STATE, IGNORE_MEM_CODE, 
-                                                                               displayString, isPreemptive, &lastMsgOS);                     
+                   logFileHeadPtr = osRecordEngine(logFileHeadPtr,
+                            TRACE_BLANK_LINE, 0, DEVICE_COUNT, 0, 0, configPtr,
+                                                    displayString, &lastMsgOS);
 
-                   logFileHeadPtr = osStringEngine(tempPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                      IGNORE_OSCODE, READY_STATE, IGNORE_MEM_CODE, 
-                                                                               displayString, isPreemptive, &lastMsgOS);  
-                     
-                   interruptManager(tempPtr, interruptQueue, prcCount, HANDLE_INTERRUPT);
-                   
+                   // service the oldest interrupt, or every pending one when
+                   // draining
+                   do
+                     {
+                      tempPtr = findProcess(prcHeadPtr,
+                                           peekInterruptQueue(interruptQueue));
+
+                      logFileHeadPtr = osStringEngine(tempPtr, logFileHeadPtr,
+                              simTimer, configPtr, CPU_INTERRUPT, IGNORE_STATE,
+                                  IGNORE_MEM_CODE, displayString, isPreemptive,
+                                                                   &lastMsgOS);
+
+                      logFileHeadPtr = logStateChange(tempPtr, logFileHeadPtr,
+                               simTimer, configPtr, READY_STATE, displayString,
+                                                     isPreemptive, &lastMsgOS);
+                        
+                      interruptManager(tempPtr, interruptQueue, prcCount,
+                                                             HANDLE_INTERRUPT);
+                     }
+                   while (drainInterrupts
+                         && peekInterruptQueue(interruptQueue)
+                                                        != EMPTY_QUEUE_VALUE);
                   }
                 else if (cpuCycleCount == configPtr->quantumCycles && prcWkgPtr->opHeadPtr->intArg2 != EMPTY_CYCLE_COUNT && isPreemptive)
                   {
-                   logFileHeadPtr = displayCommand(logFileHeadPtr, "\n", configPtr->logToCode);
+                   logFileHeadPtr = osRecordEngine(logFileHeadPtr,
+                            TRACE_BLANK_LINE, 0, DEVICE_COUNT, 0, 0, configPtr,
+                                                    displayString, &lastMsgOS);
                   
-                   logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                         CPU_QUANTUM, IGNORE_STATE, IGNORE_MEM_CODE, 
-                                                                            displayString, isPreemptive, &lastMsgOS);
+                   logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr,
+                                simTimer, configPtr, CPU_QUANTUM, IGNORE_STATE,
+                                  IGNORE_MEM_CODE, displayString, isPreemptive,
+                                                                   &lastMsgOS);
                   }
                 else if (prcWkgPtr->opHeadPtr->intArg2 == EMPTY_CYCLE_COUNT)
                   {
-                   logFileHeadPtr = processStringEngine(prcWkgPtr->opHeadPtr, logFileHeadPtr, 
-                                                                    prcWkgPtr->processId, COMMAND_END, 
-                                                                        configPtr->logToCode, displayString, isPreemptive, &lastMsgOS);
+                   logFileHeadPtr = logCpuOp(prcWkgPtr->processId,
+                              logFileHeadPtr, simTimer, configPtr, COMMAND_END,
+                                      displayString, isPreemptive, &lastMsgOS);
                    prcWkgPtr->opHeadPtr = clearOpCommand(prcWkgPtr->opHeadPtr);
                   }
                
@@ -1437,50 +3773,98 @@ void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
 
           if (prcWkgPtr->opHeadPtr == NULL || memoryCode == ALLOCATE_FAILIURE || memoryCode == ACCESS_FAILIURE)
             {
-             logFileHeadPtr = displayCommand(logFileHeadPtr, "\n", configPtr->logToCode);
+             logFileHeadPtr = osRecordEngine(logFileHeadPtr, TRACE_BLANK_LINE,
+                  0, DEVICE_COUNT, 0, 0, configPtr, displayString, &lastMsgOS);
 
-             logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                      PROCESS_END, IGNORE_STATE, memoryCode, 
-                                                                            displayString, isPreemptive, &lastMsgOS);
+             logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr,
+                    simTimer, configPtr, PROCESS_END, IGNORE_STATE, memoryCode,
+                                      displayString, isPreemptive, &lastMsgOS);
              
              memoryCode = DEALLOCATE;
 
-             memHeadPtr = handleMemory(prcWkgPtr, configPtr, memHeadPtr, &memoryCode);
+             memMapPtr = handleMemory(prcWkgPtr, configPtr, memMapPtr,
+                                                                  &memoryCode);
 
              
-             logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, configPtr->logToCode, 
-                                                      IGNORE_OSCODE, EXIT_STATE, IGNORE_MEM_CODE, 
-                                                                            displayString, isPreemptive, &lastMsgOS);
+             logFileHeadPtr = logStateChange(prcWkgPtr, logFileHeadPtr,
+                  simTimer, configPtr, EXIT_STATE, displayString, isPreemptive,
+                                                                   &lastMsgOS);
              
              prcWkgPtr->processState = EXIT_STATE;
             }         
          }
 
+       // display the time the cpu spent idle
+       lapTime = accessTimer(simTimer, LAP_TIMER);
+
+       logFileHeadPtr = osRecordEngine(logFileHeadPtr, TRACE_IDLE_TIME,
+                  lapTime, DEVICE_COUNT, idleTime, 0, configPtr, displayString,
+                                                                   &lastMsgOS);
+
+       // display the queueing delay of each device with limited units
+       for (deviceCode = 0; deviceCode < DEVICE_COUNT; deviceCode++)
+         {
+          if (deviceServers[deviceCode].unitCount > 0)
+            {
+             logFileHeadPtr = osRecordEngine(logFileHeadPtr,
+                                       TRACE_DEVICE_QUEUE, lapTime, deviceCode,
+                                       deviceServers[deviceCode].queueWaitNSec,
+                 deviceServers[deviceCode].queuedOps, configPtr, displayString,
+                                                                   &lastMsgOS);
+            }
+         }
+
+       // display the disk head travel
+       if (diskPtr != NULL)
+         {
+          logFileHeadPtr = osRecordEngine(logFileHeadPtr, TRACE_DISK_TRAVEL,
+             lapTime, DEVICE_COUNT, diskPtr->headTravel, diskPtr->requestCount,
+                                         configPtr, displayString, &lastMsgOS);
+         }
+
+       // display the internal fragmentation of the buddy system
+       if (memMapPtr != NULL
+                           && memMapPtr->placementCode == MEM_PLACE_BUDDY_CODE)
+         {
+          logFileHeadPtr = osRecordEngine(logFileHeadPtr,
+                                TRACE_MEM_FRAGMENTATION, lapTime, DEVICE_COUNT,
+                      memMapPtr->totalWaste, memMapPtr->placedCount, configPtr,
+                                                    displayString, &lastMsgOS);
+         }
+
        // display system stop
-       logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, 
-                            configPtr->logToCode, SYS_STOP, IGNORE_STATE, 
+       logFileHeadPtr = osStringEngine(prcWkgPtr, logFileHeadPtr, simTimer,
+                            configPtr, SYS_STOP, IGNORE_STATE, 
                                        IGNORE_MEM_CODE,displayString, isPreemptive, &lastMsgOS);
 
+       // stop the io workers before the processes they refer to are freed
+       eventQueue = clearEventQueue(eventQueue);
+
        prcHeadPtr = clearProcesses(prcHeadPtr);
 
        memoryCode = DEINITIALIZE;
 
-       memHeadPtr = handleMemory(NULL, configPtr, memHeadPtr, &memoryCode);
+       memMapPtr = handleMemory(NULL, configPtr, memMapPtr, &memoryCode);
        
-       sem_destroy(&interruptLock);
+       interruptQueue = clearInterruptQueue(interruptQueue);
 
-       free(thread_id);
+       deviceServers = clearDeviceServers(deviceServers);
+
+       diskPtr = clearDisk(diskPtr);
 
        // display simulator end
-       logFileHeadPtr = osStringEngine(prcHeadPtr, logFileHeadPtr, 
-                            configPtr->logToCode, SIM_END, IGNORE_STATE, 
+       logFileHeadPtr = osStringEngine(prcHeadPtr, logFileHeadPtr, simTimer,
+                            configPtr, SIM_END, IGNORE_STATE, 
                                     IGNORE_MEM_CODE, displayString, isPreemptive, &lastMsgOS);
 
-       accessTimer(STOP_TIMER, timeString);
+       accessTimer(simTimer, STOP_TIMER);
 
-       // write stored output to file 
-       writeToFile(logFileHeadPtr, configPtr, displayString);
+       // write the rest of the output and close the log file
+       logFileHeadPtr = closeLogFile(logFileHeadPtr);
 
-       logFileHeadPtr = clearLogFileStruct(logFileHeadPtr);
+       // show the rest of the buffered monitor output
+       fflush(stdout);
       }
+
+    simTimer = clearTimer(simTimer);
    }
\ No newline at end of file
@@ -4,12 +4,50 @@
 #include <pthread.h>
 #include <stdlib.h>
 #include <sys/time.h>
-#include <semaphore.h>
+#include <unistd.h>
 #include "configops.h"
 #include "metadataops.h"
 #include "stringUtil.h"
 #include "datatypes.h"
 #include "simtimer.h"
+#include "simlog.h"
+
+// slot of the interrupt queue ring
+typedef struct interruptSlotStruct
+   {
+    // ring position the slot is ready for, tells producers and the 
+    // consumer whose turn it is
+    long long sequence;
+
+    // process raising the interrupt
+    int processId;
+
+   } interruptSlotType;
+
+
+// bounded lock free ring of raised interrupts, any thread may add 
+// interrupts but only the simulation removes them
+typedef struct interruptQueueStruct
+   {
+    // ring storage, capacity is a power of two
+    interruptSlotType *slots;
+    long long capacity;
+
+    // next position to remove, owned by the simulation
+    long long head;
+
+    // next position to claim, shared by the producers
+    long long tail;
+
+    // set while the simulation sleeps waiting for an interrupt
+    bool idleWaiting;
+
+    // wakes the simulation waiting idle
+    pthread_mutex_t idleLock;
+    pthread_cond_t idleSignal;
+
+   } InterruptQueueType;
+
 
 // process control board
 typedef struct processStruct
@@ -21,7 +59,7 @@ typedef struct processStruct
     int processState;
 
     // process run time
-    int processRunTime;
+    long long processRunTime;
     
     // on board io cycle runtime
     int ioCycleTime;
@@ -33,7 +71,17 @@ typedef struct processStruct
     struct processStruct *nextPtr;
 
     // pointer to the interrupt queue
-    int *interruptQueue;
+    InterruptQueueType *interruptQueue;
+
+    // timer of the simulation the process belongs to
+    SimTimerType *timerPtr;
+
+    // memory blocks allocated to the process
+    struct memoryStruct *memBlocks;
+
+    // address tree of the process blocks by requested base, used when 
+    // the simulator places memory so each process has its own addresses
+    struct memoryStruct *memTree;
 
    } processType;
 
@@ -44,52 +92,277 @@ typedef struct memoryStruct
     int processId;
     
     // base value for the memory block
-    int memBase;
+    long long memBase;
 
     // offset value for the size of the memory block
-    int memOffset;
+    long long memOffset;
 
-    // points to the next memory node in ll
+    // base the block was placed at, the requested base when requests
+    // name their own base
+    long long physBase;
+
+    // points to the previous and next memory nodes in allocation order
+    struct memoryStruct *prevBlock;
     struct memoryStruct *nextBlock;
+
+    // points to the next memory node of the same process
+    struct memoryStruct *nextProcessBlock;
+
+    // blocks with lower and higher bases in the address tree, and the
+    // height of the subtree under this block
+    struct memoryStruct *lowerBlock;
+    struct memoryStruct *higherBlock;
+    int height;
     
    } memoryType;
 
 
-// log file linked list for storing output
+// orders the free memory trees are kept in
+typedef enum { FREE_BY_BASE,
+               FREE_BY_SIZE,
+               FREE_TREE_COUNT } FreeTreeOrders;
+
+
+// extent of free simulated memory, kept in a tree ordered by base for
+// coalescing and first or next fit, and in a tree ordered by size then
+// base for best fit
+typedef struct freeBlockStruct
+   {
+    // first address and size of the extent
+    long long base;
+    long long size;
+
+    // children and subtree heights in each tree, indexed by FreeTreeOrders
+    struct freeBlockStruct *lowerBlock[FREE_TREE_COUNT];
+    struct freeBlockStruct *higherBlock[FREE_TREE_COUNT];
+    int height[FREE_TREE_COUNT];
+
+    // largest extent in the subtree of the base ordered tree
+    long long largestSize;
+
+   } freeBlockType;
+
+
+// free buddy blocks of one size, one bit per block set while the block
+// is free, each level above has one bit per word of the level below set
+// while that word has a free block, so the lowest free block is found 
+// by reading one word per level
+typedef struct buddyBitmapStruct
+   {
+    // bit words and word counts of each level, the block bits are 
+    // level zero
+    unsigned long long *levelBits[BUDDY_BITMAP_LEVELS];
+    long long levelWords[BUDDY_BITMAP_LEVELS];
+    int levelCount;
+
+    // blocks of this size that fit in memory
+    long long blockCount;
+
+   } buddyBitmapType;
+
+
+// simulated memory, allocated blocks are listed in allocation order for
+// display and kept in a balanced tree ordered by base for the overlap 
+// and access checks
+typedef struct memoryMapStruct
+   {
+    // first and last blocks in allocation order
+    memoryType *headBlock;
+    memoryType *tailBlock;
+
+    // root of the address tree, used when requests name their own base
+    memoryType *rootBlock;
+
+    // ConfigDataCodes of how allocations are placed
+    int placementCode;
+
+    // free memory when the simulator places allocations, and where the 
+    // next fit search starts
+    freeBlockType *freeRoot[FREE_TREE_COUNT];
+    long long nextFitBase;
+
+    // buddy system free blocks indexed by order, a block of order n is 
+    // the smallest block size shifted by n
+    buddyBitmapType *buddyOrders;
+    int buddyOrderCount;
+    int buddyMinShift;
+
+    // internal fragmentation (KB) of the last buddy allocation, and the 
+    // total and count over the simulation
+    long long lastWaste;
+    long long totalWaste;
+    long long placedCount;
+
+   } memoryMapType;
+
+
+// hard drive request waiting in the disk queue
+typedef struct diskRequestStruct
+   {
+    // process making the request
+    struct processStruct *prcPtr;
+
+    // target cylinder
+    int cylinder;
+
+    // time the request arrived and its transfer time (nsec)
+    long long arrivalTime;
+    long long transferNSec;
+
+    // points to the next later arrival
+    struct diskRequestStruct *nextRequest;
+
+   } diskRequestType;
+
+
+// hard drive model, one head serving requests in the scheduler's order
+typedef struct diskStruct
+   {
+    // disk scheduling code, cylinder count and seek time per cylinder
+    int schedCode;
+    int cylinderCount;
+    long long seekNSec;
+
+    // head position and sweep direction
+    int headCylinder;
+    bool headUp;
+
+    // set while a request is being served
+    bool busy;
+
+    // waiting requests in arrival order
+    diskRequestType *queueHead;
+    diskRequestType *queueTail;
+
+    // head travel in cylinders and requests served
+    long long headTravel;
+    int requestCount;
+
+    // guards the disk, requests arrive from the simulation and 
+    // complete on the io workers
+    pthread_mutex_t diskLock;
+
+   } diskType;
+
+
+// pending io completion event
+typedef struct eventStruct
+   {
+    // simulation time the io operation completes (nsec)
+    long long eventTime;
+
+    // order the event was added, breaks ties between equal times
+    long long sequence;
+
+    // process to interrupt on completion
+    struct processStruct *prcPtr;
+
+    // disk to start its next request on completion, if any
+    diskType *diskPtr;
+
+   } eventType;
+
+
+// min heap of pending io completions, earliest completion at the root
+typedef struct eventQueueStruct
+   {
+    // heap array and its size
+    eventType *heap;
+    int eventCount;
+    int capacity;
+
+    // next sequence number to hand out
+    long long nextSequence;
+
+    // guards the heap, signals the io workers when events are added
+    pthread_mutex_t eventLock;
+    pthread_cond_t eventSignal;
+
+    // pool of io workers delivering completions on the wall clock
+    pthread_t *workers;
+    int workerCount;
+    bool shutdown;
+
+    // simulation timer and interrupt queue completions are delivered to
+    SimTimerType *timerPtr;
+    InterruptQueueType *interruptQueue;
+
+   } eventQueueType;
+
+
+// io device server, its units serve operations first come first served
+typedef struct deviceServerStruct
+   {
+    // number of units, zero serves every operation at once
+    int unitCount;
+
+    // time each unit finishes the operations queued on it (nsec)
+    long long *unitFreeTime;
+
+    // total time operations waited for a free unit (nsec), and how
+    // many operations had to wait
+    long long queueWaitNSec;
+    int queuedOps;
+
+   } deviceServerType;
+
+
+// chunk of logged event records, formatted by the writer thread
+typedef struct logChunkStruct
+   {
+    // records used and available in the record storage
+    int used;
+    int capacity;
+
+    // pointer to next chunk in the writer queue or free list
+    struct logChunkStruct *nextChunk;
+
+    // record storage, allocated with the chunk
+    traceRecordType records[];
+
+   } logChunkType;
+
+
+// streaming log file, the simulation fills chunks and a writer thread
+// writes full chunks to the file
 typedef struct logFileStruct
    {
-    // string storage
-    char opCommand[MAX_STR_LEN];
-    
-    // pointer to next node
-    struct logFileStruct *nextCommand;
+    // chunk being appended to, owned by the simulation
+    logChunkType *tailChunk;
 
-   } logFileType;
+    // full chunks waiting for the writer, bounded by LOG_QUEUE_CHUNKS
+    logChunkType *queueHead;
+    logChunkType *queueTail;
+    int queuedChunks;
+
+    // written chunks kept for reuse
+    logChunkType *freeChunks;
+
+    // open log file and its writer thread
+    FILE *filePtr;
+    pthread_t writerThread;
+    bool shutdown;
+
+    // ConfigDataCodes of the file format, text, binary trace or
+    // trace viewer events
+    int logToCode;
+
+    // trace viewer output state, and whether the last text line 
+    // written was OS output, both owned by the writer
+    chromeStateType chromeState;
+    bool fileLastMsgOS;
+
+    // microseconds time of the last binary trace record, each record
+    // stores the time since the one before it
+    long long traceLastUSec;
 
-// enum struct for OS related operations/identifiers
-typedef enum { PROCESS_START  = -1,
-               PROCESS_END    = -2,
-               COMMAND_START  = -3,
-               COMMAND_END    = -4,
-               BLOCKED_IO     = -5,
-               SIM_START      = -6,
-               SIM_END        = -7,
-               SYS_STOP       = -8,
-               IGNORE_OSCODE  = -9,
-               CPU_INTERRUPT  = -10,
-               CPU_QUANTUM    = -11 } OsCodes;
-
-// enum struct for Memory related operations/identifiers
-typedef enum { INITIALIZE,
-               ALLOCATE,
-               ALLOCATE_SUCCESS,
-               ALLOCATE_FAILIURE,
-               ACCESS,
-               ACCESS_SUCCESS,
-               ACCESS_FAILIURE,
-               DEALLOCATE,
-               DEINITIALIZE,
-               IGNORE_MEM_CODE } MemCodes;
+    // guards the queue, signals the writer when a chunk is queued and
+    // the simulation when there is room in the queue
+    pthread_mutex_t logLock;
+    pthread_cond_t chunkSignal;
+    pthread_cond_t spaceSignal;
+
+   } logFileType;
 
 typedef enum { INITIALIZE_QUEUE,
                ADD_TO_QUEUE,
@@ -101,57 +374,276 @@ typedef enum { INITIALIZE_QUEUE,
 //////////////////////////////
 //    INTERRUPT MANAGER     //
 //////////////////////////////
-void addToQueue(int *interruptQueue, int processId);
+bool addToQueue(InterruptQueueType *interruptQueue, int processId);
+
+InterruptQueueType *clearInterruptQueue(InterruptQueueType *interruptQueue);
 
 void *handleIO(void *args);
 
-int *initializeQueue(int prcCount);
+InterruptQueueType *initializeQueue(int prcCount);
+
+InterruptQueueType *interruptManager(processType *prcPtr,
+                      InterruptQueueType *queue, int queueSize, int interCode);
+
+int peekInterruptQueue(InterruptQueueType *interruptQueue);
 
-int *interruptManager(processType *prcPtr, int *queue, int queueSize, int interCode);
+void popInterruptQueue(InterruptQueueType *interruptQueue);
 
-void popInterruptQueue(int *interruptQueue, int queueSize);
+void waitForInterrupt(InterruptQueueType *interruptQueue);
+
+
+//////////////////////////////
+//      EVENT FUNCTIONS     //
+//////////////////////////////
+void addEvent(eventQueueType *queue, processType *prcPtr, diskType *diskPtr, 
+                                                           long long eventTime);
+
+eventQueueType *clearEventQueue(eventQueueType *queue);
+
+eventQueueType *createEventQueue(SimTimerType *timerPtr,
+            InterruptQueueType *interruptQueue, int capacity, int workerCount);
+
+int cyclesToHorizon(long long eventTime, long long currentTime, int cycleRate,
+                                              int quantumCycles, int opCycles);
+
+void deliverEvent(eventQueueType *queue, eventType *eventPtr);
+
+void deliverEvents(eventQueueType *queue, long long currentTime);
+
+bool eventBefore(eventType *oneEvent, eventType *otherEvent);
+
+long long nextEventTime(eventQueueType *queue);
+
+eventType popEvent(eventQueueType *queue);
+
+
+//////////////////////////////
+//     DEVICE FUNCTIONS     //
+//////////////////////////////
+deviceServerType *clearDeviceServers(deviceServerType *servers);
+
+deviceServerType *createDeviceServers(ConfigDataType *configPtr);
+
+long long scheduleDeviceOp(deviceServerType *servers, const char *deviceName,
+                                 long long arrivalTime, long long serviceTime);
+
+
+//////////////////////////////
+//      DISK FUNCTIONS      //
+//////////////////////////////
+diskType *clearDisk(diskType *diskPtr);
+
+void completeDiskRequest(diskType *diskPtr, eventQueueType *queue, 
+                                                     long long completionTime);
+
+diskType *createDisk(ConfigDataType *configPtr);
+
+void dispatchDiskRequest(diskType *diskPtr, eventQueueType *queue,
+                                                               long long time);
+
+diskRequestType *selectDiskRequest(diskType *diskPtr, long long time);
+
+void submitDiskRequest(diskType *diskPtr, eventQueueType *queue,
+                      processType *prcPtr, int cylinder, long long arrivalTime,
+                                                       long long transferNSec);
 
 
 //////////////////////////////
 //    LOGFILE FUNCTIONS     //
 //////////////////////////////
-logFileType *addLogFileNode(logFileType *ptr, char *command);
+logChunkType *addLogChunk(logFileType *logPtr);
 
-logFileType *clearLogFileStruct(logFileType *logPtr);
+logFileType *appendLogRecord(logFileType *logPtr,
+                                             const traceRecordType *recordPtr);
 
-logFileType *displayCommand(logFileType *logPtr, char *toWrite, int displayCode);
+logFileType *closeLogFile(logFileType *logPtr);
 
-logFileType *osStringEngine(processType *prcPtr, logFileType *logHeadPtr, 
-                                 int displayCode, int osCode, int stateCode, int memCode,
-                                           char *displayString, bool isPreemptive, bool *lastMsgOS);
+bool logEventShown(ConfigDataType *cfgPtr, int logLevel, int eventClass,
+                                                                int processId);
+
+logFileType *logTraceRecord(logFileType *logPtr, traceRecordType *recordPtr,
+                        int displayCode, char *displayString, bool *lastMsgOS);
+
+logFileType *memRecordEngine(logFileType *logHeadPtr, SimTimerType *timerPtr,
+                   int prcId, memoryMapType *memMapPtr, ConfigDataType *cfgPtr,
+                                         char *displayString, bool *lastMsgOS);
+
+logFileType *osRecordEngine(logFileType *logHeadPtr, int traceKind,
+            long long timeNSec, int deviceCode, long long value, long long arg,
+                 ConfigDataType *cfgPtr, char *displayString, bool *lastMsgOS);
+
+logFileType *osStringEngine(processType *prcPtr, logFileType *logHeadPtr,
+     SimTimerType *timerPtr, ConfigDataType *cfgPtr, int osCode, int stateCode,
+         int memCode, char *displayString, bool isPreemptive, bool *lastMsgOS);
 
 logFileType *processStringEngine(OpCodeType *opWkgPtr, logFileType *logHeadPtr,
-                                          int prcId, int cmdtype, int displayCode, 
-                                             char *displayString, bool isPreemptive, bool *lastMsgOS);
+        SimTimerType *timerPtr, int prcId, int cmdtype, ConfigDataType *cfgPtr,
+                      char *displayString, bool isPreemptive, bool *lastMsgOS);
+
+logFileType *openLogFile(ConfigDataType *cfgPtr, char *displayString);
 
-void writeToFile(logFileType *logPtr, ConfigDataType *cfgPtr, char *displayString);
+void submitLogChunk(logFileType *logPtr);
+
+void *writeLogChunks(void *args);
+
+void writeLogRecords(logFileType *logPtr, const logChunkType *chunkPtr);
+
+
+//////////////////////////////
+//     LOG FAST PATHS       //
+//////////////////////////////
+
+// logs a process state change, the most common event, with the record 
+// filled in place and no op or OS code dispatch
+static inline logFileType *logStateChange(processType *prcPtr,
+       logFileType *logHeadPtr, SimTimerType *timerPtr, ConfigDataType *cfgPtr,
+        int stateCode, char *displayString, bool isPreemptive, bool *lastMsgOS)
+   {
+    // initialize function/variables
+    traceRecordType record = { 0 };
+
+    // drop filtered events before reading the timer
+    if (!logEventShown(cfgPtr, LOG_LEVEL_PROCESS_CODE, LOG_EVENT_STATE,
+                                                            prcPtr->processId))
+      {
+       return logHeadPtr;
+      }
+
+    record.timeNSec = accessTimer(timerPtr, LAP_TIMER);
+    record.processId = prcPtr->processId;
+    record.code = stateCode;
+    record.kind = TRACE_OS_STATE;
+    record.detail = prcPtr->processState;
+    record.device = DEVICE_COUNT;
+    record.isPreemptive = isPreemptive;
+
+    return logTraceRecord(logHeadPtr, &record, cfgPtr->logToCode,
+                                                     displayString, lastMsgOS);
+   }
+
+// logs the start or end of a cpu op, without comparing the op command
+static inline logFileType *logCpuOp(int prcId, logFileType *logHeadPtr,
+                   SimTimerType *timerPtr, ConfigDataType *cfgPtr, int cmdType,
+                       char *displayString, bool isPreemptive, bool *lastMsgOS)
+   {
+    // initialize function/variables
+    traceRecordType record = { 0 };
+
+    // drop filtered events before reading the timer
+    if (!logEventShown(cfgPtr, LOG_LEVEL_OP_CODE, LOG_EVENT_CPU, prcId))
+      {
+       return logHeadPtr;
+      }
+
+    record.timeNSec = accessTimer(timerPtr, LAP_TIMER);
+    record.processId = prcId;
+    record.code = cmdType;
+    record.kind = TRACE_PROCESS_OP;
+    record.detail = TRACE_OP_CPU;
+    record.device = DEVICE_COUNT;
+    record.isPreemptive = isPreemptive;
+
+    return logTraceRecord(logHeadPtr, &record, cfgPtr->logToCode,
+                                                     displayString, lastMsgOS);
+   }
 
 
 //////////////////////////////
 //     MEMORY FUNCTIONS     //
 //////////////////////////////
-memoryType *addMemoryNode(memoryType *memPtr, int prcId, int memBase, int memOffset);
+memoryMapType *addMemoryNode(memoryMapType *memMapPtr, processType *prcPtr,
+                   long long memBase, long long memOffset, long long physBase);
+
+int blockHeight(memoryType *blockPtr);
+
+memoryType *balanceBlock(memoryType *blockPtr);
+
+freeBlockType *balanceFreeBlock(freeBlockType *blockPtr, int order);
+
+int buddyOrder(memoryMapType *memMapPtr, long long size);
+
+memoryMapType *clearBuddyOrders(memoryMapType *memMapPtr);
+
+freeBlockType *clearFreeBlocks(freeBlockType *rootPtr);
+
+memoryMapType *clearMemory(memoryMapType *memMapPtr);
+
+void displayBuddyBlocks(memoryMapType *memMapPtr);
+
+void displayFreeBlocks(freeBlockType *rootPtr);
+
+bool findAccess(memoryType *rootPtr, int prcId, long long accessBase,
+                                                       long long accessOffset);
+
+freeBlockType *findBestFit(freeBlockType *rootPtr, long long size);
+
+memoryType *findBlockAtOrBelow(memoryType *rootPtr, long long address);
+
+bool findConflict(long long desiredBase, long long desiredOffset,
+                                  long long memAvailable, memoryType *rootPtr);
+
+freeBlockType *findFirstFit(freeBlockType *rootPtr, long long size,
+                                                           long long fromBase);
+
+freeBlockType *findFreeAtOrBelow(freeBlockType *rootPtr, long long address);
+
+long long findFreeBuddy(buddyBitmapType *bitmapPtr, int level,
+                                                          long long fromIndex);
+
+bool freeBlockBefore(freeBlockType *firstPtr, freeBlockType *secondPtr,
+                                                                    int order);
+
+int freeBlockHeight(freeBlockType *blockPtr, int order);
+
+memoryMapType *handleMemory(processType *prcCurrent, ConfigDataType *configPtr,
+                                       memoryMapType *memMapPtr, int *memCode);
+
+memoryMapType *initBuddyOrders(memoryMapType *memMapPtr,
+                                                       long long memAvailable);
+
+memoryType *insertBlock(memoryType *rootPtr, memoryType *blockPtr);
+
+freeBlockType *insertFreeBlock(freeBlockType *rootPtr, freeBlockType *blockPtr,
+                                                                    int order);
+
+memoryMapType *insertFreeExtent(memoryMapType *memMapPtr,
+                                                      freeBlockType *blockPtr);
+
+void memoryStringEngine(memoryMapType *memMapPtr, processType *prcPtr,
+                                           long long totalMemory, int *memCode);
+
+long long placeBuddy(memoryMapType *memMapPtr, long long size);
+
+long long placeMemory(memoryMapType *memMapPtr, long long size);
+
+memoryMapType *releaseBuddy(memoryMapType *memMapPtr, long long base,
+                                                               long long size);
+
+memoryMapType *releaseMemory(memoryMapType *memMapPtr, long long base,
+                                                               long long size);
+
+memoryMapType *removeBlock(memoryMapType *memMapPtr, processType *prcPtr);
+
+memoryMapType *removeFreeExtent(memoryMapType *memMapPtr,
+                                                      freeBlockType *blockPtr);
+
+freeBlockType *removeFreeBlock(freeBlockType *rootPtr, freeBlockType *blockPtr,
+                                                                    int order);
 
-memoryType *clearMemory(memoryType *memPtr);
+memoryType *removeTreeBlock(memoryType *rootPtr, memoryType *blockPtr);
 
-bool findAccess(memoryType *memPtr, int prcId, int accessBase, int accessOffset);
+memoryType *rotateBlock(memoryType *blockPtr, bool toLower);
 
-bool findConflict(int desiredBase, int desiredOffset, int memAvailable, memoryType *memWkgPtr);
+freeBlockType *rotateFreeBlock(freeBlockType *blockPtr, bool toLower,
+                                                                    int order);
 
-memoryType *handleMemory(processType *prcCurrent, ConfigDataType *configPtr, 
-                                                  memoryType *memHeadPtr, int *memCode);
+void setBuddyBit(buddyBitmapType *bitmapPtr, long long index, bool isFree);
 
-bool inMemory(processType *prcPtr, memoryType *memPtr);
+bool testBuddyBit(buddyBitmapType *bitmapPtr, long long index);
 
-void memoryStringEngine(memoryType *memHeadPtr, processType *prcPtr,
-                                                 int totalMemory, int *memCode);
+void updateBlockHeight(memoryType *blockPtr);
 
-memoryType *removeBlock(memoryType *memHeadPtr, processType *prcPtr);
+void updateFreeBlock(freeBlockType *blockPtr, int order);
 
 
 //////////////////////////////
@@ -161,7 +653,7 @@ bool allProcessBlocked(processType *prcPtr);
 
 bool allProcessExit(processType *prcPtr);
 
-int calculateRunTime(processType *prcPtr, ConfigDataType *cfgPtr);
+long long calculateRunTime(processType *prcPtr, ConfigDataType *cfgPtr);
 
 bool checkPreemptive(ConfigDataType *cfgPtr);
 
@@ -171,13 +663,15 @@ int countProccesses(processType *prcPtr);
 
 processType *findProcess(processType *prcWkgPtr, int prcToFind);
 
-processType *getProcess(processType *prcHeadPtr, ConfigDataType *cfgPtr, bool *quantumCyclesHit);
+processType *getProcess(processType *prcHeadPtr, ConfigDataType *cfgPtr,
+                             bool *quantumCyclesHit, processType **lastPrcPtr);
 
 processType *initializeProcess(processType *prcPtr, int prcId);
 
 bool lastProcessAvailable(processType *prcPtr, int totalCount);
 
-processType *uploadToPCB(OpCodeType *opWkgPtr, ConfigDataType *cfgPtr, processType *pcbPtr);
+processType *uploadToPCB(OpCodeType *opWkgPtr, ConfigDataType *cfgPtr,
+                                               processType *pcbPtr, int prcId);
 
 
 //////////////////////////////
@@ -425,7 +425,7 @@ void setStrToLowerCase( char *destStr, const char *sourceStr )
 
     // copy source string in case of aliasing
        // function: malloc, copyString
-    tempStr = (char *)malloc(sizeof(sourceStrLen + 1));
+    tempStr = (char *)malloc(sourceStrLen + 1);
     copyString(tempStr, sourceStr);
 
     // loop across source string